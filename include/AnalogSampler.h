@@ -0,0 +1,97 @@
+/**
+ * @file AnalogSampler.h
+ * @brief Non-blocking round-robin ADC sampling
+ * @author Andrea Bortolotti
+ * @version 2.0
+ * @ingroup HAL
+ */
+#ifndef ANALOG_SAMPLER_H
+#define ANALOG_SAMPLER_H
+
+#include <Arduino.h>
+
+/**
+ * @class AnalogSampler
+ * @brief Singleton converting analog channels in the background
+ * @ingroup HAL
+ *
+ * @details Owns the ADC between blocking reads: every SAMPLE_INTERVAL_MS
+ * it starts one conversion on the next registered channel and collects the
+ * result on a later update() once ADSC clears, so a sample costs a register
+ * check instead of a 104 us busy-wait. Each channel is converted every
+ * SAMPLE_INTERVAL_MS times the channel count.
+ *
+ * Blocking readers (analogRead(), the VCC bandgap measurement) call claim()
+ * first; it waits out a conversion in flight so they never pick up its
+ * result. ADMUX is written in full before every conversion, so whatever
+ * they leave in it does not matter.
+ */
+class AnalogSampler {
+public:
+    static constexpr uint8_t MAX_CHANNELS = 4;       ///< Channel slots
+    static constexpr uint8_t NO_SLOT = 0xFF;         ///< add() failed
+    static constexpr uint8_t SAMPLE_INTERVAL_MS = 5; ///< One conversion started per interval
+
+private:
+    uint8_t _channels[MAX_CHANNELS];  ///< ADC channel (MUX bits) per slot
+    uint16_t _values[MAX_CHANNELS];   ///< Last result per slot (0-1023)
+    uint8_t _count;                   ///< Slots in use
+    uint8_t _current;                 ///< Slot converted last / in flight
+    uint8_t _fresh;                   ///< Slots with a result not yet taken
+    bool _busy;                       ///< Conversion in flight
+    uint8_t _lastStart;               ///< millis() of the last start, truncated
+
+    /**
+     * @brief Private constructor for singleton pattern
+     */
+    AnalogSampler() : _count(0), _current(0), _fresh(0), _busy(false), _lastStart(0) {}
+
+    /**
+     * @brief Stores the finished conversion and moves to the next slot
+     */
+    void collect();
+
+public:
+    /**
+     * @brief Gets singleton instance
+     * @return Reference to AnalogSampler instance
+     */
+    static AnalogSampler& instance();
+
+    /**
+     * @brief Adds an analog pin to the rotation
+     * @param pin Arduino analog pin (A0-A7)
+     * @return Slot for take(), or NO_SLOT if all slots are used
+     * @note The first value is read at once with analogRead()
+     */
+    uint8_t add(uint8_t pin);
+
+    /**
+     * @brief Collects a finished conversion and starts the next when due
+     * @note Call every loop; returns at once while the ADC is busy
+     */
+    void update();
+
+    /**
+     * @brief Takes a new result for a slot
+     * @param slot Slot returned by add()
+     * @param value Receives the result (0-1023)
+     * @return False if no conversion finished since the last take, or
+     * the slot is NO_SLOT
+     */
+    bool take(uint8_t slot, uint16_t& value);
+
+    /**
+     * @brief Frees the ADC for a blocking read
+     * @details Waits for a conversion in flight (at most one conversion
+     * time) and keeps its result.
+     */
+    void claim() {
+        if (_busy) {
+            while (bit_is_set(ADCSRA, ADSC));
+            collect();
+        }
+    }
+};
+
+#endif
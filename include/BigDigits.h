@@ -0,0 +1,88 @@
+/**
+ * @file BigDigits.h
+ * @brief Two-row tall numerals built from custom CGRAM glyphs
+ * @author Andrea Bortolotti
+ * @version 2.0
+ * @ingroup UI
+ *
+ * Each numeral is 3 cells wide and 2 rows tall, assembled from 7 segment
+ * glyphs plus the ROM full block. The renderer writes one numeral at a
+ * time so callers can repaint only the positions whose value changed.
+ */
+#ifndef BIG_DIGITS_H
+#define BIG_DIGITS_H
+
+#include <Arduino.h>
+#include "CustomChars.h"
+
+constexpr uint8_t BIG_GLYPHS = 7;  ///< Segment glyphs used by the big numerals
+
+/**
+ * @brief Segment glyphs used by the big numerals
+ * @ingroup UI
+ */
+extern const uint8_t GLYPH_BIG[BIG_GLYPHS][8] PROGMEM;
+
+/**
+ * @brief Renders 3x2-cell numerals using CGRAM segment glyphs
+ * @ingroup UI
+ *
+ * Holds references to all 7 segment glyphs from construction until
+ * release(); acquire() takes them back. When another widget pins CGRAM
+ * slots, isReady() returns false and the caller should fall back to plain
+ * text.
+ */
+class BigDigitRenderer {
+private:
+    uint8_t _slots[BIG_GLYPHS];  ///< CGRAM slot for each segment glyph
+
+public:
+    static constexpr uint8_t WIDTH = 3;  ///< Cells per numeral
+
+    /**
+     * @brief Acquires the segment glyphs from CGRAMManager
+     */
+    BigDigitRenderer();
+
+    /**
+     * @brief Releases the segment glyphs
+     */
+    ~BigDigitRenderer();
+
+    /**
+     * @brief Acquires the segment glyphs that are not held yet
+     * @return True if all of them are resident
+     * @details On failure every glyph is released again, so a renderer
+     * that cannot draw does not keep slots from other widgets.
+     */
+    bool acquire();
+
+    /**
+     * @brief Releases the segment glyphs so other widgets can use the slots
+     */
+    void release();
+
+    /**
+     * @brief Checks that every segment glyph is resident
+     * @return True if numerals can be drawn
+     */
+    bool isReady() const;
+
+    /**
+     * @brief Writes the cells of one numeral into two row buffers
+     * @param top Upper row buffer (3 cells written)
+     * @param bottom Lower row buffer (3 cells written)
+     * @param c '0'-'9', '-' or ' '
+     */
+    void compose(char* top, char* bottom, char c) const;
+
+    /**
+     * @brief Draws one numeral directly on the LCD
+     * @param col Left column
+     * @param row Upper row (the numeral also covers row + 1)
+     * @param c '0'-'9', '-' or ' '
+     */
+    void draw(uint8_t col, uint8_t row, char c) const;
+};
+
+#endif
@@ -34,7 +34,9 @@ enum class DeviceType : uint8_t {
     SensorPIR,          ///< Passive infrared motion sensor
     SensorRAM,          ///< Free RAM monitor
     SensorVCC,          ///< Supply voltage monitor
-    SensorLoopTime      ///< Loop execution time monitor
+    SensorLoopTime,     ///< Loop execution time monitor
+    SensorLcdTraffic,   ///< LCD I2C bus traffic monitor
+    SensorUiLatency     ///< Input-to-display latency monitor
 };
 
 /**
@@ -48,7 +50,8 @@ enum class EventType : uint8_t {
     ButtonPressed,        ///< Physical button press detected
     DeviceStateChanged,   ///< Device on/off state changed
     DeviceValueChanged,   ///< Device value (brightness, color) changed
-    SensorUpdated         ///< Sensor reading updated
+    SensorUpdated,        ///< Sensor reading updated
+    AlarmTriggered        ///< Alarm scene detected motion (source = PIR sensor)
 };
 
 /**
@@ -60,7 +63,8 @@ enum class InputEvent : uint8_t {
     UP,     ///< Navigate up in menu
     DOWN,   ///< Navigate down in menu
     ENTER,  ///< Select/confirm action
-    BACK    ///< Return to previous menu
+    BACK,   ///< Return to previous menu
+    RELEASE ///< Auto-repeating UP/DOWN key let go
 };
 
 class MenuPage;
@@ -165,6 +169,12 @@ public:
      * @return Number of elements in array
      */
     uint8_t size() const { return _size; }
+
+    /**
+     * @brief Gets allocated element slots
+     * @return Capacity of the storage block
+     */
+    uint8_t capacity() const { return _capacity; }
 };
 
 class IDevice;
@@ -269,6 +279,91 @@ public:
     }
 };
 
+/**
+ * @class InputQueue
+ * @brief Singleton FIFO of navigation input between the input and UI stages
+ * @ingroup Core
+ *
+ * @details Inputs push events in O(1) while polling; NavigationManager drains
+ * the queue in its update stage, so page construction and redraws never run
+ * inside the input loop and every button is polled before any UI work.
+ * Consecutive UP or DOWN presses still waiting in the queue are coalesced
+ * into one entry with a press count instead of taking new slots.
+ */
+class InputQueue {
+public:
+    /**
+     * @brief One queued input
+     */
+    struct Entry {
+        InputEvent event;  ///< Navigation command
+        uint8_t step;      ///< Auto-repeat step multiplier (0 = single press)
+        uint8_t count;     ///< Presses coalesced into this entry
+        uint16_t stamp;    ///< millis() of the first press, truncated
+    };
+
+    static constexpr uint8_t CAPACITY = 8;  ///< Slots (power of two)
+
+private:
+    Entry _entries[CAPACITY];  ///< Ring buffer storage
+    uint8_t _head;             ///< Index of the oldest entry
+    uint8_t _count;            ///< Entries waiting
+
+    /**
+     * @brief Private constructor for singleton pattern
+     */
+    InputQueue() : _head(0), _count(0) {}
+
+public:
+    /**
+     * @brief Gets singleton instance
+     * @return Reference to InputQueue instance
+     */
+    static InputQueue& instance() {
+        static InputQueue inst;
+        return inst;
+    }
+
+    /**
+     * @brief Queues an input, merging it into a matching UP/DOWN tail entry
+     * @param event Navigation command
+     * @param step Auto-repeat step multiplier (0 = single press)
+     * @return false if the queue was full and the event was dropped
+     */
+    bool push(InputEvent event, uint8_t step = 0) {
+        if (_count > 0 && (event == InputEvent::UP || event == InputEvent::DOWN)) {
+            Entry& tail = _entries[(_head + _count - 1) & (CAPACITY - 1)];
+            if (tail.event == event && (tail.step == 0) == (step == 0)) {
+                if (tail.count < 255) tail.count++;
+                tail.step = step;
+                return true;
+            }
+        }
+        if (_count == CAPACITY) return false;
+
+        Entry& entry = _entries[(_head + _count) & (CAPACITY - 1)];
+        entry.event = event;
+        entry.step = step;
+        entry.count = 1;
+        entry.stamp = static_cast<uint16_t>(millis());
+        _count++;
+        return true;
+    }
+
+    /**
+     * @brief Removes the oldest entry
+     * @param out Receives the entry
+     * @return false if the queue was empty
+     */
+    bool pop(Entry& out) {
+        if (_count == 0) return false;
+        out = _entries[_head];
+        _head = (_head + 1) & (CAPACITY - 1);
+        _count--;
+        return true;
+    }
+};
+
 /**
  * @class IDevice
  * @brief Abstract base class for all controllable devices
@@ -0,0 +1,92 @@
+/**
+ * @file CustomChars.h
+ * @brief CGRAM slot manager for HD44780 custom glyphs
+ * @author Andrea Bortolotti
+ * @version 2.0
+ * @ingroup UI
+ *
+ * The HD44780 only offers 8 user-definable characters. Widgets request glyphs
+ * by their PROGMEM bitmap address; the manager hands out slots with reference
+ * counting, reuses glyphs that are already resident and evicts the least
+ * recently used unreferenced slot when all 8 are taken.
+ */
+#ifndef CUSTOM_CHARS_H
+#define CUSTOM_CHARS_H
+
+#include <Arduino.h>
+#include <avr/pgmspace.h>
+
+/**
+ * @brief Bar graph glyphs with 1 to 4 filled pixel columns
+ * @details Index i has (i + 1) columns lit. A full cell uses ROM char 0xFF.
+ * @ingroup UI
+ */
+extern const uint8_t GLYPH_BAR[4][8] PROGMEM;
+
+/**
+ * @brief Singleton allocator for the 8 CGRAM character slots
+ * @ingroup UI
+ *
+ * Slots stay resident after their last release so that a widget re-entering
+ * the screen does not pay for a second upload. Only slots with a zero
+ * reference count are eligible for eviction, so glyphs visible on screen
+ * are never overwritten.
+ */
+class CGRAMManager {
+private:
+    /**
+     * @brief State of one CGRAM slot
+     */
+    struct Slot {
+        const uint8_t* glyph;  ///< Resident PROGMEM bitmap (nullptr = never used)
+        uint8_t refCount;      ///< Number of active users
+        uint16_t lastUse;      ///< LRU stamp from _clock
+    };
+
+    static constexpr uint8_t SLOT_COUNT = 8;  ///< HD44780 CGRAM capacity
+    Slot _slots[SLOT_COUNT];                  ///< Slot table
+    uint16_t _clock;                          ///< LRU counter, restarted on wrap
+
+    CGRAMManager();
+
+    /**
+     * @brief Advances the LRU clock
+     * @return New stamp
+     * @details On wrap every stamp is reset, so no age is ever computed
+     * across the wrap; the slots briefly share one age instead.
+     */
+    uint16_t tick();
+
+public:
+    static constexpr uint8_t NO_SLOT = 0xFF;  ///< Returned when every slot is in use
+
+    /**
+     * @brief Gets singleton instance
+     * @return Reference to CGRAM manager
+     */
+    static CGRAMManager& instance();
+
+    /**
+     * @brief Acquires a slot holding the given glyph
+     * @param glyph 8-byte bitmap in PROGMEM
+     * @return Slot index (0-7) usable as LCD character code, or NO_SLOT
+     *
+     * @note Uploading a glyph moves the LCD address counter into CGRAM.
+     * Callers must set the cursor before writing text again.
+     */
+    uint8_t acquire(const uint8_t* glyph);
+
+    /**
+     * @brief Releases a slot obtained with acquire()
+     * @param slot Slot index (NO_SLOT is ignored)
+     */
+    void release(uint8_t slot);
+
+    /**
+     * @brief Forgets all resident glyphs
+     * @details Call after the controller has been re-initialised.
+     */
+    void invalidate();
+};
+
+#endif
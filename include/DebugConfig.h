@@ -32,4 +32,11 @@
  */
 #define DEBUG_EVENTS 0
 
+/**
+ * @brief Run the display redraw benchmark at boot
+ * @details When enabled, the average time of a full 20x4 page redraw
+ * is shown for 3 seconds before the menu starts
+ */
+#define DEBUG_LCD_BENCH 0
+
 #endif
@@ -6,7 +6,7 @@
  * 
  * @details Provides all device abstractions for the smart home system:
  * - Light devices (Simple, Dimmable, RGB, Outside)
- * - Sensor devices (Temperature, Light, PIR, RAM, VCC, LoopTime)
+ * - Sensor devices (Temperature, Light, PIR, RAM, VCC, LoopTime, LcdTraffic, UiLatency)
  * - Device factory for convenient instantiation
  * 
  * @ingroup Devices
@@ -44,6 +44,7 @@ private:
     int16_t _max;                                  ///< Maximum recorded value
     int32_t _sum;                                  ///< Running sum for average calculation
     uint16_t _count;                               ///< Number of samples recorded
+    int16_t _last;                                 ///< Most recent sample (kept across reset)
     static constexpr uint16_t MAX_SAMPLES = 1000;  ///< Reset threshold
     static constexpr int16_t MIN_INITIAL = 32767;  ///< Initial minimum value
     static constexpr int16_t MAX_INITIAL = -32768; ///< Initial maximum value
@@ -78,6 +79,12 @@ public:
      */
     int16_t getAverage() const;
     
+    /**
+     * @brief Gets the most recent sample
+     * @return Last value passed to addSample(), or 0 before the first one
+     */
+    int16_t getLast() const { return _last; }
+
     /**
      * @brief Resets all statistics to initial state
      */
@@ -650,6 +657,131 @@ public:
     SensorStats& getStats() { return _stats; }
 };
 
+/**
+ * @class LcdTrafficSensorDevice
+ * @brief LCD bus traffic monitoring device with statistics
+ * @ingroup Devices
+ *
+ * @details Reports bytes per second sent to the display over I2C,
+ * averaged over the update interval. Reads 0 while the UI is idle.
+ *
+ * Estimate, not a measurement: over I2C one character costs 12 bus bytes,
+ * so a full page redraw is about 1 KB and a page redrawn every second
+ * about 3.6 MB/h. Read this sensor's Avg on hardware for the real figure.
+ */
+class LcdTrafficSensorDevice : public IDevice {
+private:
+    int16_t _rate;                 ///< Current traffic in bytes per second
+    uint32_t _lastCount;           ///< Counter value at last reading
+    unsigned long _lastRead;       ///< Timestamp of last reading
+    SensorStats _stats;            ///< Statistics tracker
+    LcdTrafficSensor _trafficSensor; ///< Low-level sensor driver
+    static constexpr unsigned long UPDATE_INTERVAL_MS = 10000;
+
+public:
+    /**
+     * @brief Constructor for LCD traffic sensor device
+     * @param name Device identifier name (Flash string)
+     */
+    explicit LcdTrafficSensorDevice(const __FlashStringHelper* name);
+
+    /**
+     * @brief Checks if device is a sensor
+     * @return true always
+     */
+    bool isSensor() const override { return true; }
+
+    /**
+     * @brief Periodic update - samples the byte counter at defined interval
+     */
+    void update() override;
+
+    /**
+     * @brief Gets current traffic rate
+     * @return Bytes per second
+     */
+    int16_t getValue() const { return _rate; }
+
+    /**
+     * @brief Gets statistics tracker
+     * @return Reference to SensorStats object
+     */
+    SensorStats& getStats() { return _stats; }
+};
+
+/**
+ * @class UiLatencySensorDevice
+ * @brief Input-to-display latency monitoring device
+ * @ingroup Devices
+ *
+ * @details Exposes the UiLatencySensor summary and emits SensorUpdated at
+ * most once per interval, only when new samples arrived.
+ */
+class UiLatencySensorDevice : public IDevice {
+private:
+    UiLatencySensor _latencySensor;  ///< Sample collector
+    uint16_t _lastCount;             ///< Sample count at last report
+    unsigned long _lastRead;         ///< Timestamp of last report
+    static constexpr unsigned long UPDATE_INTERVAL_MS = 1000;
+
+public:
+    /**
+     * @brief Constructor for UI latency sensor device
+     * @param name Device identifier name (Flash string)
+     */
+    explicit UiLatencySensorDevice(const __FlashStringHelper* name);
+
+    /**
+     * @brief Checks if device is a sensor
+     * @return true always
+     */
+    bool isSensor() const override { return true; }
+
+    /**
+     * @brief Periodic update - reports new samples at defined interval
+     */
+    void update() override;
+
+    /**
+     * @brief Gets the most recent latency
+     * @return Milliseconds
+     */
+    int16_t getValue() const { return _latencySensor.getValue(); }
+
+    /**
+     * @brief Gets the best latency
+     * @return Milliseconds
+     */
+    int16_t getMin() const { return static_cast<int16_t>(_latencySensor.getMin()); }
+
+    /**
+     * @brief Gets the average latency
+     * @return Milliseconds
+     */
+    int16_t getAverage() const { return static_cast<int16_t>(_latencySensor.getAverage()); }
+
+    /**
+     * @brief Gets the 95th percentile latency
+     * @return Milliseconds
+     */
+    int16_t getP95() const { return static_cast<int16_t>(_latencySensor.getP95()); }
+
+    /**
+     * @brief Gets the worst latency
+     * @return Milliseconds
+     */
+    int16_t getMax() const { return static_cast<int16_t>(_latencySensor.getMax()); }
+
+    /**
+     * @brief Gets the per-page breakdown
+     * @param slot Slot index (0 to UiLatencySensor::PAGE_SLOTS - 1)
+     * @return Page summary
+     */
+    const UiLatencySensor::PageLatency& getPage(uint8_t slot) const {
+        return _latencySensor.getPage(slot);
+    }
+};
+
 /**
  * @class OutsideLight
  * @brief Outdoor light with sensors and automation
@@ -791,6 +923,18 @@ public:
      * @param name Device name (Flash string)
      */
     static void createLoopTimeSensor(const __FlashStringHelper* name);
+
+    /**
+     * @brief Creates an LCD bus traffic sensor
+     * @param name Device name (Flash string)
+     */
+    static void createLcdTrafficSensor(const __FlashStringHelper* name);
+
+    /**
+     * @brief Creates an input-to-display latency sensor
+     * @param name Device name (Flash string)
+     */
+    static void createUiLatencySensor(const __FlashStringHelper* name);
 };
 
 #endif
\ No newline at end of file
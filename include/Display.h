@@ -0,0 +1,182 @@
+/**
+ * @file Display.h
+ * @brief Character display abstraction with HD44780 and SSD1306 backends
+ * @author Andrea Bortolotti
+ * @version 2.0
+ * @ingroup UI
+ *
+ * The menu talks to a 20x4 character grid through IDisplay and never calls a
+ * panel driver directly. The backend is chosen at build time:
+ * - default: HD44780 20x4 LCD through lib/lcd
+ * - DISPLAY_SSD1306: 128x64 OLED, each cell 6x16 pixels
+ */
+#ifndef DISPLAY_H
+#define DISPLAY_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Abstract 20x4 character display
+ * @ingroup UI
+ *
+ * Cursor and write semantics follow the HD44780: characters 0-7 are the
+ * user-defined glyphs, 0xDF is the degree sign, 0xA5 a middle dot and
+ * 0xFF a full block.
+ */
+class IDisplay {
+public:
+    static constexpr uint8_t COLS = 20;  ///< Grid width in characters
+    static constexpr uint8_t ROWS = 4;   ///< Grid height in characters
+
+    virtual ~IDisplay() {}
+
+    /**
+     * @brief Gets the backend selected at build time
+     * @return Reference to the display
+     */
+    static IDisplay& instance();
+
+    /**
+     * @brief Initializes the panel (I2C must already be up)
+     */
+    virtual void begin() = 0;
+
+    /**
+     * @brief Blanks the whole grid and homes the cursor
+     */
+    virtual void clear() = 0;
+
+    /**
+     * @brief Moves the write position
+     * @param col Column (0-19)
+     * @param row Row (0-3)
+     */
+    virtual void setCursor(uint8_t col, uint8_t row) = 0;
+
+    /**
+     * @brief Writes exactly len characters at the cursor
+     * @param data Characters (may contain glyph code 0)
+     * @param len Number of characters
+     */
+    virtual void write(const char* data, uint8_t len) = 0;
+
+    /**
+     * @brief Writes one character at the cursor
+     * @param c Character code
+     */
+    virtual void writeChar(char c) = 0;
+
+    /**
+     * @brief Writes a null-terminated RAM string at the cursor
+     * @param text String to write
+     */
+    void print(const char* text) { write(text, strlen(text)); }
+
+    /**
+     * @brief Loads a user-defined glyph
+     * @param slot Glyph code (0-7)
+     * @param bitmap 8 rows of 5 pixels, bit 4 = leftmost, in RAM
+     */
+    virtual void defineGlyph(uint8_t slot, const uint8_t* bitmap) = 0;
+
+    /**
+     * @brief Switches the backlight or panel on/off
+     * @param on True to light the display
+     */
+    virtual void setPower(bool on) = 0;
+
+    /**
+     * @brief Pushes buffered changes to the panel
+     * @details No-op for backends that write through immediately.
+     */
+    virtual void flush() {}
+
+    /**
+     * @brief Gets the bytes moved over the bus since boot
+     * @return Address and data bytes counted by the backend
+     */
+    virtual uint32_t busBytes() const = 0;
+};
+
+/**
+ * @brief HD44780 20x4 LCD through the lib/lcd driver
+ * @ingroup UI
+ *
+ * Writes go straight to the controller; the panel keeps its own DDRAM so no
+ * frame buffer is needed.
+ */
+class HD44780Display : public IDisplay {
+public:
+    void begin() override;
+    void clear() override;
+    void setCursor(uint8_t col, uint8_t row) override;
+    void write(const char* data, uint8_t len) override;
+    void writeChar(char c) override;
+    void defineGlyph(uint8_t slot, const uint8_t* bitmap) override;
+    void setPower(bool on) override;
+    uint32_t busBytes() const override;
+};
+
+/**
+ * @brief SSD1306 128x64 OLED emulating the 20x4 character grid
+ * @ingroup UI
+ *
+ * Each cell is a 6x16 tile (5x7 font stretched to double height), covering
+ * two 8-pixel OLED pages. Writes only update the character buffer and set a
+ * bit in the per-row dirty map when the cell actually changes; flush() sends
+ * each run of dirty tiles as one windowed transfer per page. A cell rewritten
+ * with the same character costs no bus traffic at all.
+ */
+class SSD1306Display : public IDisplay {
+private:
+    static constexpr uint8_t ADDRESS = 0x3C << 1;  ///< 7-bit address 0x3C, write form
+    static constexpr uint8_t CELL_WIDTH = 6;       ///< Pixel columns per cell (5 + gap)
+    static constexpr uint8_t X_OFFSET = 4;         ///< Centers 120 px of text in 128
+
+    char _text[ROWS][COLS];      ///< Characters currently in each cell
+    uint8_t _glyphs[8][8];       ///< User-defined glyphs, HD44780 row format
+    uint32_t _dirty[ROWS];       ///< Bit c set = cell (c, row) must be sent
+    uint8_t _col;                ///< Cursor column
+    uint8_t _row;                ///< Cursor row
+    bool _on;                    ///< Panel powered
+    uint32_t _busBytes;          ///< Bytes sent since boot
+
+    /**
+     * @brief Sends a command sequence
+     * @param cmds Command bytes in RAM
+     * @param len Number of bytes
+     */
+    void command(const uint8_t* cmds, uint8_t len);
+
+    /**
+     * @brief Sends one run of tiles on one page
+     * @param row Text row
+     * @param half 0 = upper page, 1 = lower page
+     * @param first First column of the run
+     * @param last Last column of the run
+     */
+    void sendRun(uint8_t row, uint8_t half, uint8_t first, uint8_t last);
+
+    /**
+     * @brief Gets one pixel column of a character, LSB = top
+     * @param c Character code
+     * @param x Column inside the cell (0-5)
+     * @return 8 vertical pixels
+     */
+    uint8_t columnBits(char c, uint8_t x) const;
+
+public:
+    SSD1306Display();
+
+    void begin() override;
+    void clear() override;
+    void setCursor(uint8_t col, uint8_t row) override;
+    void write(const char* data, uint8_t len) override;
+    void writeChar(char c) override;
+    void defineGlyph(uint8_t slot, const uint8_t* bitmap) override;
+    void setPower(bool on) override;
+    void flush() override;
+    uint32_t busBytes() const override;
+};
+
+#endif
@@ -14,16 +14,21 @@
 
 #include <Arduino.h>
 #include <avr/pgmspace.h>
-extern "C" {
-    #include "lcd.h"
-}
+#include "Display.h"
 #include "Devices.h"
 #include "Scenes.h"
+#include "CustomChars.h"
+#include "TextFormat.h"
+#include "BigDigits.h"
 
 class MenuPage;
 class NavigationManager;
 class SubMenuItem;
 
+#define LCD_COLS 20        ///< Display width in characters
+#define LCD_ROWS 4         ///< Display height in rows
+#define MENU_ITEM_COLS 19  ///< Cells owned by an item row (last column holds scroll marks)
+
 /**
  * @brief Base menu item type discriminator
  * @ingroup UI
@@ -63,6 +68,12 @@ public:
      * @return MenuItemType enum value
      */
     virtual MenuItemType getType() const { return MenuItemType::GENERIC; }
+
+    /**
+     * @brief Number of LCD rows the item occupies when drawn
+     * @return Row count (1 for list entries)
+     */
+    virtual uint8_t getHeight() const { return 1; }
     
     /**
      * @brief Checks if item is related to a specific device
@@ -71,37 +82,171 @@ public:
      */
     virtual bool relatesTo(IDevice* device) { return false; }
 
+    /**
+     * @brief Redraws only the cells that depend on live data
+     * @param row LCD row the item starts on
+     * @param selected True if item is selected
+     * @details Called when a related device changed. The default redraws the
+     * whole item; items with a fixed label override it to touch just the value.
+     */
+    virtual void drawValue(uint8_t row, bool selected) { draw(row, selected); }
+
+    /**
+     * @brief Checks if the item keeps CGRAM glyphs acquired while it exists
+     * @return True for items that pin custom characters
+     * @details Pages holding such items are not kept in PageCache, so hidden
+     * pages never lock glyph slots other widgets need.
+     */
+    virtual bool holdsGlyphs() const { return false; }
+
+    /**
+     * @brief Gets the heap bytes the item occupies
+     * @return Object size plus any heap it owns, without allocator headers
+     * @details Summed by PageCache to account for cached pages; measuring
+     * free RAM instead misses blocks recycled from the malloc free list.
+     */
+    virtual uint16_t footprint() const = 0;
+
+    /**
+     * @brief Describes where the item draws its label, for marquee scrolling
+     * @param col Receives the first column of the label field
+     * @param width Receives the field width in cells
+     * @return Flash label, or nullptr if the item has no scrollable label
+     */
+    virtual const __FlashStringHelper* getLabel(uint8_t& col, uint8_t& width) const {
+        static_cast<void>(col);
+        static_cast<void>(width);
+        return nullptr;
+    }
+
 protected:
     /**
-     * @brief Helper to print RAM string to LCD
-     * @param str String in RAM
+     * @brief Writes the selection marker into the first two cells of a row
+     * @param line Row buffer
+     * @param selected True to draw the "> " cursor
      */
-    void printLabel(const char* str);
-    
+    static void putCursor(char* line, bool selected);
+
+    /**
+     * @brief Sends a composed row buffer to the LCD in one write
+     * @param row LCD row (0-3)
+     * @param line Row buffer (not NUL-terminated)
+     * @param len Number of cells to write from column 0
+     */
+    static void writeRow(uint8_t row, const char* line, uint8_t len);
+
     /**
-     * @brief Helper to print Flash string to LCD
-     * @param f_str String in PROGMEM
+     * @brief Sends a run of cells to the LCD starting at any column
+     * @param col First column
+     * @param row LCD row (0-3)
+     * @param cells Cell buffer (not NUL-terminated)
+     * @param len Number of cells
      */
-    void printLabel(const __FlashStringHelper* f_str);
+    static void writeCells(uint8_t col, uint8_t row, const char* cells, uint8_t len);
 };
 
 /**
  * @brief Menu page container with event-driven updates
  * @ingroup UI
  * 
- * Manages a collection of menu items with scrolling support. Listens to device
- * events and triggers redraws when related devices change.
+ * Manages a collection of menu items with scrolling support. Device events
+ * are forwarded by NavigationManager while the page is on top and trigger
+ * redraws of related items.
  */
-class MenuPage : public MenuItem, public IEventListener {
-private:
+class MenuPage : public MenuItem {
+public:
+    static constexpr uint8_t ALL_ROWS = (1 << LCD_ROWS) - 1;  ///< Row mask of the whole display
+
+protected:
     const __FlashStringHelper* _title;
     DynamicArray<MenuItem*> _items;
     MenuPage* _parent;
     size_t _selected_index;
     size_t _scroll_offset;
     bool _needs_redraw;
+    uint8_t _dirty_rows;  ///< Bit r set = item starting on LCD row r needs drawValue()
+    PageBuilder _origin;       ///< Builder that created the page (set by PageCache)
+    void* _originContext;      ///< Context passed to _origin
+    uint16_t _footprint;       ///< Heap bytes held, from footprint() (set by PageCache)
     
     friend class NavigationManager;
+    friend class PageCache;
+
+    static constexpr uint8_t HEAP_HEADER = 2;  ///< avr-libc malloc bytes per block
+
+    /**
+     * @brief Gets the heap bytes of the item array and the items in it
+     * @return Bytes including one allocator header per block
+     */
+    uint16_t itemsFootprint() const;
+
+    /**
+     * @brief Gets the item behind an entry
+     * @param index Entry index
+     * @return Item, or nullptr for entries that are not MenuItem objects
+     * @details Pages that generate rows on demand may return a transient
+     * item that stays valid only until the next call.
+     */
+    virtual MenuItem* itemAt(size_t index);
+
+    /**
+     * @brief Gets the selected item for handling input
+     * @return Item, or nullptr
+     * @details Defaults to itemAt(). Pages with transient rows build it
+     * apart from them, so events raised by the item cannot replace it.
+     */
+    virtual MenuItem* inputItem();
+
+    /**
+     * @brief Draws one entry on an LCD row
+     * @param index Entry index
+     * @param row LCD row (1-3)
+     * @param selected True to draw the cursor
+     */
+    virtual void drawRow(size_t index, uint8_t row, bool selected);
+
+    /**
+     * @brief Gets the number of LCD rows an entry occupies
+     * @param index Entry index
+     * @return Row count
+     */
+    virtual uint8_t getRowHeight(size_t index) const;
+
+    /**
+     * @brief Gets the label field of an entry
+     * @param index Entry index
+     * @param col Receives the first column of the label field
+     * @param width Receives the field width in cells
+     * @return Flash label, or nullptr if the entry has none
+     */
+    virtual const __FlashStringHelper* getRowLabel(size_t index, uint8_t& col, uint8_t& width);
+
+    /**
+     * @brief Moves the selection for UP/DOWN and scrolls if needed
+     * @param event Input event
+     * @return True if the event was UP or DOWN
+     */
+    bool moveCursor(InputEvent event);
+
+    /**
+     * @brief Marks an item for a value-only redraw if it is visible
+     * @param index Item index
+     */
+    void markDirty(size_t index);
+
+    /**
+     * @brief Redraws the values of dirty visible items
+     * @param hidden Bit r set = LCD row r is covered; items touching it stay dirty
+     */
+    void renderDirty(uint8_t hidden = 0);
+
+    /**
+     * @brief Repaints whole LCD rows from the page content
+     * @param rows Bit r set = repaint LCD row r
+     * @details Used by render() with ALL_ROWS and by NavigationManager to
+     * restore the cells a notification covered.
+     */
+    virtual void renderRows(uint8_t rows);
 
 public:
     /**
@@ -130,7 +275,7 @@ public:
      * @brief Gets total number of items
      * @return Item count
      */
-    size_t getItemsCount() const;
+    virtual size_t getItemsCount() const;
     
     /**
      * @brief Gets parent page
@@ -146,7 +291,20 @@ public:
 
     void draw(uint8_t row, bool selected) override;
     bool handleInput(InputEvent event) override;
-    void handleEvent(EventType type, IDevice* device, int value) override;
+
+    /**
+     * @brief Reacts to a device event while this page is displayed
+     * @param type Event type received
+     * @param device Device that triggered the event
+     * @param value Event-specific value
+     */
+    virtual void handleEvent(EventType type, IDevice* device, int value);
+
+    /**
+     * @brief Activates the selected entry on ENTER
+     * @return Page to push (submenus) or nullptr
+     */
+    virtual MenuPage* handleEnter();
     
     /**
      * @brief Checks if page needs redrawing
@@ -155,14 +313,241 @@ public:
     bool needsRedraw() const;
     
     /**
-     * @brief Clears redraw flag after rendering
+     * @brief Checks if some visible items need a value-only redraw
+     * @return True if any row is dirty
+     */
+    bool hasDirtyRows() const;
+
+    /**
+     * @brief Clears redraw flag and dirty rows after rendering
      */
     void clearRedraw();
     
     /**
      * @brief Forces full page redraw
      */
-    void forceRedraw();
+    virtual void forceRedraw();
+
+    /**
+     * @brief Called before another page is opened on top of this one
+     * @details Pages holding CGRAM glyphs release them here so the new page
+     * can load its own; forceRedraw() runs when the page is on top again.
+     */
+    virtual void onCovered() {}
+
+    /**
+     * @brief Checks if the page may be kept in PageCache after BACK
+     * @return True unless an item holds CGRAM glyphs
+     */
+    virtual bool isCacheable() const;
+
+    /**
+     * @brief Builds ahead the page that ENTER on the selected entry would open
+     * @details Called by NavigationManager once the cursor has settled; the
+     * page is parked in PageCache so the following ENTER skips the builder.
+     */
+    virtual void prefetchSelected();
+
+    /**
+     * @brief Renders the whole page: title, visible items and scroll marks
+     * @details Pages with a custom layout override this together with
+     * renderRows(). Called by NavigationManager whenever a redraw is pending.
+     */
+    virtual void render();
+
+    /**
+     * @brief Periodic hook called every loop while the page is shown
+     * @details Lets time-driven pages request a redraw without an event.
+     */
+    virtual void tick() {}
+
+    /**
+     * @brief Gets the heap bytes held by the page
+     * @return Page object plus item array and items, without allocator headers
+     */
+    uint16_t footprint() const override;
+};
+
+/**
+ * @brief Kind of row in a PROGMEM menu table
+ * @ingroup UI
+ */
+enum class MenuEntryKind : uint8_t {
+    ACTION,  ///< Runs action(context, param) and goes back
+    TABLE,   ///< Opens another menu table
+    PAGE,    ///< Opens a page built at runtime by builder(context)
+    BACK     ///< Returns to the previous page
+};
+
+struct MenuTable;
+
+/**
+ * @brief One row of a static menu, stored in PROGMEM
+ * @ingroup UI
+ */
+struct MenuEntry {
+    const char* label;               ///< Row label (PROGMEM)
+    MenuEntryKind kind;              ///< What ENTER does
+    void (*action)(IDevice*, int);   ///< ACTION callback
+    int16_t param;                   ///< ACTION parameter
+    const MenuTable* child;          ///< TABLE target
+    PageBuilder builder;             ///< PAGE builder
+};
+
+/**
+ * @brief Static menu description, stored in PROGMEM
+ * @ingroup UI
+ */
+struct MenuTable {
+    const char* title;         ///< Page title (PROGMEM)
+    const MenuEntry* entries;  ///< Rows (PROGMEM)
+    uint8_t count;             ///< Number of rows
+};
+
+/**
+ * @brief Page that walks a PROGMEM menu table directly
+ * @ingroup UI
+ *
+ * Allocates no MenuItem objects: labels, actions and children are read from
+ * flash on demand, so an open level costs only the page object. That is
+ * still every MenuPage field (vtable pointer, title, parent, cursor, scroll
+ * offset, flags, cache key and footprint, and the _items header, whose array
+ * stays unallocated) plus the table and context pointers: 26 bytes on AVR,
+ * 28 with the malloc header.
+ */
+class TablePage : public MenuPage {
+private:
+    const MenuTable* _table;  ///< Menu description in PROGMEM
+    void* _context;           ///< Passed to actions and child pages
+
+    /**
+     * @brief Copies one entry from PROGMEM
+     * @param index Entry index
+     * @param entry Destination
+     */
+    void readEntry(size_t index, MenuEntry& entry) const;
+
+protected:
+    void drawRow(size_t index, uint8_t row, bool selected) override;
+    uint8_t getRowHeight(size_t index) const override;
+    const __FlashStringHelper* getRowLabel(size_t index, uint8_t& col, uint8_t& width) override;
+
+public:
+    /**
+     * @brief Constructs a page for a menu table
+     * @param table Table in PROGMEM
+     * @param context Device or data handed to actions and child pages
+     * @param parent Parent page
+     */
+    TablePage(const MenuTable* table, void* context, MenuPage* parent);
+
+    size_t getItemsCount() const override;
+    bool handleInput(InputEvent event) override;
+    MenuPage* handleEnter() override;
+    void prefetchSelected() override;
+    uint16_t footprint() const override { return sizeof(*this) + itemsFootprint(); }
+};
+
+/**
+ * @brief Singleton LRU cache of recently closed pages
+ * @ingroup UI
+ *
+ * Pages built through open() remember their (builder, context) key. When
+ * BACK pops such a page it is parked here instead of deleted, and the next
+ * open() with the same key returns it without running the builder again, so
+ * re-entering Lights or Sensors no longer reallocates every item and rescans
+ * DeviceRegistry. The cache holds at most SLOTS pages and BUDGET_BYTES of
+ * heap; least recently used pages are evicted first, and trim() drops pages
+ * while free RAM is below MIN_FREE_RAM. prefetch() fills the cache ahead of
+ * ENTER while the UI is otherwise idle.
+ */
+class PageCache {
+private:
+    static constexpr uint8_t SLOTS = 3;             ///< Pages kept at most
+    static constexpr uint16_t BUDGET_BYTES = 320;   ///< Heap the cache may hold
+    static constexpr int MIN_FREE_RAM = 256;        ///< Free RAM below which pages are evicted
+    static constexpr int PREFETCH_FREE_RAM = 512;   ///< Free RAM required to build ahead
+    static constexpr uint8_t REFUSED_SLOTS = 4;     ///< Builders remembered as not cacheable
+
+    MenuPage* _pages[SLOTS];  ///< Cached pages, most recently used first
+    uint8_t _count;           ///< Number of cached pages
+    uint16_t _bytes;          ///< Sum of cached page footprints
+    PageBuilder _refused[REFUSED_SLOTS];  ///< Builders whose prefetched page store() refused
+    uint8_t _refusedNext;     ///< Next _refused slot to overwrite
+
+    PageCache();
+
+    /**
+     * @brief Removes a page from the cache without deleting it
+     * @param index Slot index
+     * @return The removed page
+     */
+    MenuPage* take(uint8_t index);
+
+    /**
+     * @brief Deletes the least recently used page
+     */
+    void evictOldest();
+
+    /**
+     * @brief Finds the slot holding (builder, context)
+     * @param builder Page builder
+     * @param context Context passed to builder
+     * @return Slot index, or SLOTS if not cached
+     */
+    uint8_t find(PageBuilder builder, void* context) const;
+
+    /**
+     * @brief Runs a builder and tags the page with its key and footprint
+     * @param builder Page builder
+     * @param context Context passed to builder
+     * @return New page, or nullptr if allocation failed
+     */
+    MenuPage* build(PageBuilder builder, void* context);
+
+public:
+    /**
+     * @brief Gets singleton instance
+     * @return Reference to the page cache
+     */
+    static PageCache& instance();
+
+    /**
+     * @brief Returns the cached page for (builder, context) or builds it
+     * @param builder Page builder
+     * @param context Context passed to builder
+     * @return Page ready to push, or nullptr if allocation failed
+     * @details On allocation failure the cache is flushed and the build retried.
+     */
+    MenuPage* open(PageBuilder builder, void* context);
+
+    /**
+     * @brief Parks a popped page for reuse
+     * @param page Page removed from the navigation stack
+     * @return True if the cache took ownership; false means the caller deletes it
+     */
+    bool store(MenuPage* page);
+
+    /**
+     * @brief Builds and parks a page that is likely to be opened next
+     * @param builder Page builder
+     * @param context Context passed to builder
+     * @details Does nothing if the page is already cached or free RAM is
+     * below PREFETCH_FREE_RAM. A page the cache refuses is deleted again and
+     * its builder is not prefetched any more, so pages holding glyphs or
+     * over budget are not rebuilt every time the cursor rests on them.
+     */
+    void prefetch(PageBuilder builder, void* context);
+
+    /**
+     * @brief Evicts pages while free RAM is below MIN_FREE_RAM
+     */
+    void trim();
+
+    /**
+     * @brief Deletes every cached page
+     */
+    void clear();
 };
 
 /**
@@ -170,15 +555,131 @@ public:
  * @ingroup UI
  * 
  * Manages a stack of MenuPage instances. Implements Just-In-Time strategy.
+ * After IDLE_TIMEOUT_MS without navigation input the backlight is switched
+ * off and rendering is suspended until the next key press.
+ *
+ * Navigation input arrives through InputQueue and is processed at the start
+ * of update(). It is the only UI event listener: device events are forwarded to the page
+ * on top of the stack, so pushing and popping pages never touches the
+ * EventSystem listener list.
  */
-class NavigationManager {
+class NavigationManager : public IEventListener {
 private:
     DynamicArray<MenuPage*> _stack;
     bool _initialized;
+    bool _idle;                   ///< Backlight off, no rendering
+    bool _prefetched;             ///< Prefetch already tried for the current cursor
+    uint8_t _repeatStep;          ///< Step multiplier of the event being handled (0 = single press)
+    bool _cursorMoved;            ///< Cursor moved since the last frame, rows not yet redrawn
+    size_t _cursorFrom;           ///< Selection shown on screen before the move
+    uint8_t _marqueeOffset;       ///< First label character shown on the selected row (NO_MARQUEE = fits)
+    unsigned long _marqueeNext;   ///< Timestamp of the next marquee step
+    const __FlashStringHelper* _toast[2];  ///< Notification lines (second may be nullptr)
+    uint8_t _toastRows;           ///< Rows covered by the notification (0 = none)
+    unsigned long _toastUntil;    ///< Timestamp at which the notification is removed
+    uint16_t _navFrameMs;         ///< Minimum frame period after input
+    uint16_t _liveFrameMs;        ///< Minimum frame period for live value updates
+    unsigned long _frameStart;    ///< Timestamp of the last frame that drew something
+    bool _inputSinceFrame;        ///< Input was handled since that frame
+    uint8_t _frameCount;          ///< Frames drawn in the current FPS window
+    uint8_t _fps;                 ///< Frames drawn during the last complete window
+    unsigned long _fpsWindowStart;  ///< Start of the current FPS window
+    PageBuilder _request;         ///< Page asked for outside the menu (nullptr = none)
+    void* _requestContext;        ///< Context passed to _request
+    bool _latencyPending;         ///< An input awaits its display flush
+    uint16_t _latencyStamp;       ///< Detection time of the oldest such input (truncated millis)
+    unsigned long _lastActivity;  ///< Timestamp of last navigation input
+    static constexpr unsigned long IDLE_TIMEOUT_MS = 30000;  ///< Inactivity before idle
+    static constexpr unsigned long PREFETCH_DELAY_MS = 250;  ///< Cursor rest before building ahead
+    static constexpr unsigned long MARQUEE_HOLD_MS = 1500;   ///< Pause at either end of a label
+    static constexpr unsigned long MARQUEE_STEP_MS = 300;    ///< Time per one-character shift
+    static constexpr uint8_t NO_MARQUEE = 0xFF;              ///< Selected label fits its field
+    static constexpr uint8_t TOAST_ROW = 1;                  ///< First row covered by a notification
+    static constexpr uint8_t NAV_FPS = 10;                   ///< Default frame cap while navigating
+    static constexpr uint8_t LIVE_FPS = 2;                   ///< Default frame cap for live values
+    static constexpr unsigned long FPS_WINDOW_MS = 1000;     ///< Achieved frame rate window
+    static constexpr char TOAST_BORDER = static_cast<char>(0xFF);  ///< ROM full block
 
     NavigationManager();
 
+    /**
+     * @brief Leaves idle mode: backlight on and full redraw scheduled
+     */
+    void wake();
+
+    /**
+     * @brief Handles every entry waiting in InputQueue
+     * @details A coalesced entry is replayed count times. Cursor moves are
+     * only recorded, so the rows are redrawn once by the next frame.
+     */
+    void drainInput();
+
+    /**
+     * @brief Redraws the rows of a recorded cursor move
+     * @return True if any row was drawn
+     */
+    bool drawCursor();
+
+    /**
+     * @brief Restarts the marquee from the first character
+     * @details Called when the whole screen is about to be redrawn.
+     */
+    void resetMarquee();
+
+    /**
+     * @brief Shows the selected label from its start again and restarts the marquee
+     * @details For input and partial redraws, which may leave the label on
+     * screen scrolled.
+     */
+    void rewindMarquee();
+
+    /**
+     * @brief Scrolls the selected row's label by one character when due
+     * @details Only the label cells whose character changes are rewritten.
+     */
+    void tickMarquee();
+
+    /**
+     * @brief Finds the label field of the selected row
+     * @param row Receives the LCD row
+     * @param col Receives the first column of the field
+     * @param width Receives the field width
+     * @param len Receives the label length
+     * @return Label in PROGMEM, or nullptr if the row is not on screen
+     */
+    const char* marqueeLabel(uint8_t& row, uint8_t& col, uint8_t& width, uint8_t& len);
+
+    /**
+     * @brief Moves the label window, rewriting only the cells that change
+     * @param text Label in PROGMEM
+     * @param row LCD row
+     * @param col First column of the field
+     * @param width Field width
+     * @param from Offset currently shown
+     * @param to Offset to show
+     */
+    static void writeMarquee(const char* text, uint8_t row, uint8_t col, uint8_t width,
+                             uint8_t from, uint8_t to);
+
+    /**
+     * @brief Gets the LCD rows covered by the notification
+     * @return Row mask, 0 when no notification is shown
+     */
+    uint8_t toastMask() const;
+
+    /**
+     * @brief Writes the notification rows over the current page
+     */
+    void drawToast();
+
+    /**
+     * @brief Removes the notification and repaints only the rows it covered
+     */
+    void hideToast();
+
 public:
+    static constexpr uint16_t TOAST_MS = 2000;  ///< Default notification duration
+
     /**
      * @brief Gets singleton instance
      * @return Reference to navigation manager
@@ -216,31 +717,245 @@ public:
     /**
      * @brief Delegates input to current page
      * @param event Input event
+     * @param repeatStep Step multiplier for auto-repeated keys (0 = single press)
+     * @details Wakes the display if idle; the event is still processed.
      */
-    void handleInput(InputEvent event);
+    void handleInput(InputEvent event, uint8_t repeatStep = 0);
+
+    /**
+     * @brief Opens a page on behalf of an input outside the menu
+     * @param builder Page builder
+     * @param context Context passed to builder
+     * @details Used by button gestures. The page is built in the next
+     * update(), not in the input stage, and counts as user activity: the
+     * display wakes and any notification is removed. If the page on top
+     * already came from the same builder and context, nothing is pushed.
+     */
+    void requestPage(PageBuilder builder, void* context);
+
+    /**
+     * @brief Gets the step multiplier of the event being handled
+     * @return 0 for a single press, 1-4 while a key auto-repeats
+     */
+    uint8_t getRepeatStep() const;
+
+    /**
+     * @brief Sets the frame rate caps
+     * @param navFps Frames per second allowed right after input (1-50)
+     * @param liveFps Frames per second allowed for live value updates (1-50)
+     */
+    void setFrameRates(uint8_t navFps, uint8_t liveFps);
+
+    /**
+     * @brief Gets the frame cap used after input
+     * @return Frames per second
+     */
+    int16_t getNavFrameCap() const;
+
+    /**
+     * @brief Gets the frame cap used for live value updates
+     * @return Frames per second
+     */
+    int16_t getLiveFrameCap() const;
+
+    /**
+     * @brief Gets the achieved frame rate
+     * @return Frames drawn during the last complete second
+     */
+    int16_t getFrameRate() const;
 
     /**
      * @brief Updates display if current page needs redraw
+     * @details Enters idle mode on timeout and skips all LCD traffic while idle.
+     * Redraws are paced: a frame starts at most once per frame period (the
+     * navigation cap if input arrived since the last frame, the live cap
+     * otherwise), and every change requested in between, cursor moves
+     * included, is drawn together in that frame. Only rendering is paced:
+     * flush() and latency reporting run on every call, and only frames that
+     * drew something count towards getFrameRate().
+     * After the flush that leaves nothing pending, the time since the oldest
+     * handled input was detected is reported to UiLatencySensor.
+     * Once the cursor has rested for PREFETCH_DELAY_MS with nothing left to
+     * draw, the page under the cursor is built ahead into PageCache.
      */
     void update();
 
     /**
-     * @brief Incrementally updates cursor position
+     * @brief Forwards a device event to the current page
+     * @param type Event type received
+     * @param device Device that triggered the event
+     * @param value Event-specific value
+     * @details Dropped while idle: waking forces a full redraw anyway.
+     * AlarmTriggered is handled here instead and raises a notification,
+     * which also wakes the display.
+     */
+    void handleEvent(EventType type, IDevice* device, int value) override;
+
+    /**
+     * @brief Shows a one- or two-row notification over the current page
+     * @param line1 First line (Flash string)
+     * @param line2 Second line (Flash string), nullptr for a single row
+     * @param durationMs Time before the covered rows are restored
+     * @details No page is allocated: the rows are drawn directly and repainted
+     * from the page when the notification expires or a key is pressed. Wakes
+     * the display if idle and keeps it awake while shown.
+     */
+    void notify(const __FlashStringHelper* line1, const __FlashStringHelper* line2 = nullptr,
+                uint16_t durationMs = TOAST_MS);
+
+    /**
+     * @brief Checks whether the UI is idle (backlight off)
+     * @return True if idle
+     */
+    bool isIdle() const;
+
+    /**
+     * @brief Records a cursor move for an incremental redraw
      * @param oldIndex Previous selection index
      * @param newIndex New selection index
+     * @details The two rows are redrawn by the next frame update() allows,
+     * so cursor moves obey the frame cap like everything else.
      */
     void drawIncrementalCursor(size_t oldIndex, size_t newIndex);
 
     /**
-     * @brief Renders full page with scrolling support
+     * @brief Renders the current page
      */
     void draw();
-    
+};
+
+/**
+ * @brief Home screen with uptime clock and outside temperature in big digits
+ * @ingroup UI
+ *
+ * Rows 0-1 show the uptime as HH:MM, rows 2-3 the temperature. The digits
+ * last drawn are cached so a redraw rewrites only the numerals that changed
+ * (6 cells each) instead of the whole screen. Falls back to plain text when
+ * the segment glyphs cannot be loaded.
+ */
+class HomePage : public MenuPage {
+private:
+    static constexpr uint8_t CELL_COUNT = 8;  ///< 4 time digits, 3 temperature digits, decimal point
+    static constexpr unsigned long MINUTE_MS = 60000UL;
+
+    TemperatureSensor* _sensor;   ///< Outside temperature source (may be nullptr)
+    BigDigitRenderer _big;        ///< Segment glyph owner
+    char _shown[CELL_COUNT];      ///< Characters currently on screen ('\0' = unknown)
+    unsigned long _nextMinute;    ///< millis() at which the clock shows the next minute
+
+    /**
+     * @brief Fills the characters to display for every cell
+     * @param cells Output array of CELL_COUNT characters
+     */
+    void composeCells(char* cells) const;
+
     /**
-     * @brief Helper to print Flash string
-     * @param f_str Flash string pointer
+     * @brief Draws the plain text layout used when glyphs are unavailable
+     * @param cells Characters from composeCells()
      */
-    void printLabel(const __FlashStringHelper* f_str);
+    void renderText(const char* cells);
+
+public:
+    /**
+     * @brief Constructs the home page
+     * @param sensor Temperature sensor to display (nullptr shows "--")
+     * @param parent Page returned to with BACK
+     */
+    HomePage(TemperatureSensor* sensor, MenuPage* parent);
+
+    bool handleInput(InputEvent event) override;
+    void handleEvent(EventType type, IDevice* device, int value) override;
+    void forceRedraw() override;
+    void onCovered() override;
+    bool isCacheable() const override;
+    void render() override;
+    void renderRows(uint8_t rows) override;
+    void tick() override;
+    uint16_t footprint() const override { return sizeof(*this) + itemsFootprint(); }
+};
+
+/**
+ * @brief One dashboard tile, stored in PROGMEM
+ * @ingroup UI
+ * @details The tile occupies width cells from (col, row): the label, a
+ * right-aligned value of DashboardPage::VALUE_WIDTH cells, then the unit.
+ */
+struct DashboardTile {
+    const char* label;               ///< Tile label (PROGMEM)
+    const char* unit;                ///< Unit suffix (PROGMEM, may be empty)
+    DeviceType source;               ///< Device read by the tile (Unknown = none)
+    int16_t (*read)(IDevice*);       ///< Returns the value to show
+    uint16_t periodMs;               ///< Minimum time between two reads
+    uint8_t col;                     ///< First column
+    uint8_t row;                     ///< LCD row (0-3)
+    uint8_t width;                   ///< Tile width in cells
+    bool tenths;                     ///< Value is in tenths, shown with one decimal
+};
+
+/**
+ * @class DashboardPage
+ * @brief Live overview built from a PROGMEM tile table
+ * @ingroup UI
+ *
+ * @details Each tile declares its own refresh period. tick() only marks
+ * tiles whose period elapsed; render() reads those tiles and rewrites the
+ * value cells of the ones that changed, so a slow temperature tile never
+ * costs a read or an LCD write when the loop time tile updates.
+ */
+class DashboardPage : public MenuPage {
+public:
+    static constexpr uint8_t MAX_TILES = 6;     ///< Tiles tracked per page
+    static constexpr uint8_t VALUE_WIDTH = 5;   ///< Cells of the value field
+    static constexpr int16_t UNKNOWN = INT16_MIN;  ///< Value not on screen yet
+
+private:
+    const DashboardTile* _tiles;          ///< Tile table (PROGMEM)
+    uint8_t _count;                       ///< Number of tiles in use
+    uint8_t _due;                         ///< Bit per tile whose period elapsed
+    bool _full;                           ///< Next render repaints every row
+    IDevice* _sources[MAX_TILES];         ///< Resolved tile devices
+    int16_t _shown[MAX_TILES];            ///< Values currently on screen
+    unsigned long _next[MAX_TILES];       ///< millis() of each tile's next read
+
+    /**
+     * @brief Copies one tile descriptor out of flash
+     * @param index Tile index
+     * @param tile Output descriptor
+     */
+    void readTile(uint8_t index, DashboardTile& tile) const;
+
+    /**
+     * @brief Reads the current value of a tile
+     * @param index Tile index
+     * @param tile Tile descriptor
+     * @return Value, or UNKNOWN when the tile device is missing
+     */
+    int16_t readValue(uint8_t index, const DashboardTile& tile) const;
+
+    /**
+     * @brief Formats a tile value into its VALUE_WIDTH cells
+     * @param cells Output buffer
+     * @param tile Tile descriptor
+     * @param value Value from readValue()
+     */
+    static void putValue(char* cells, const DashboardTile& tile, int16_t value);
+
+public:
+    /**
+     * @brief Constructs the dashboard and resolves each tile's device
+     * @param tiles Tile table (PROGMEM)
+     * @param count Number of tiles (capped at MAX_TILES)
+     * @param parent Page returned to with BACK
+     */
+    DashboardPage(const DashboardTile* tiles, uint8_t count, MenuPage* parent);
+
+    bool handleInput(InputEvent event) override;
+    void handleEvent(EventType type, IDevice* device, int value) override;
+    void forceRedraw() override;
+    void render() override;
+    void renderRows(uint8_t rows) override;
+    void tick() override;
+    uint16_t footprint() const override { return sizeof(*this) + itemsFootprint(); }
 };
 
 /**
@@ -260,7 +975,10 @@ public:
     
     bool relatesTo(IDevice* dev) override;
     void draw(uint8_t row, bool selected) override;
+    void drawValue(uint8_t row, bool selected) override;
     bool handleInput(InputEvent event) override;
+    const __FlashStringHelper* getLabel(uint8_t& col, uint8_t& width) const override;
+    uint16_t footprint() const override { return sizeof(*this); }
 };
 
 /**
@@ -269,6 +987,8 @@ public:
  * @tparam DeviceType Device class with getter/setter methods
  * 
  * Displays a two-row slider with label, value, and progress bar.
+ * While UP/DOWN auto-repeats the value ramps on screen and is sent to the
+ * device at most every SEND_INTERVAL_MS; RELEASE sends the exact final value.
  * Must remain in header due to template instantiation.
  */
 template<typename DeviceType>
@@ -279,27 +999,17 @@ private:
     uint8_t (DeviceType::*_getter)() const;
     void (DeviceType::*_setter)(uint8_t);
     uint8_t _min, _max, _step;
-    
-    static bool _customCharsLoaded;
-    
-    void loadCustomChars() {
-        if (!_customCharsLoaded) {
-            static const uint8_t customChars[] PROGMEM = {
-                0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-                0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-                0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-                0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
-                0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E
-            };
-            
-            uint8_t buffer[8];
-            for (uint8_t i = 0; i < 5; i++) {
-                memcpy_P(buffer, &customChars[i * 8], 8);
-                LCDcreateChar(i, buffer);
-            }
-            _customCharsLoaded = true;
-        }
-    }
+    uint8_t _barSlots[4];  ///< CGRAM slots for 1-4 pixel partial blocks
+    uint8_t _pending;      ///< Value shown while ramping
+    bool _ramping;         ///< Auto-repeat in progress, device may lag _pending
+    unsigned long _lastSent;  ///< Timestamp of the last device update while ramping
+    static constexpr uint8_t SEND_INTERVAL_MS = 100;  ///< Device update period while ramping
+
+    /**
+     * @brief Gets the value to display
+     * @return Pending value while ramping, device value otherwise
+     */
+    uint8_t shownValue() const { return _ramping ? _pending : (_device->*_getter)(); }
 
 public:
     /**
@@ -318,80 +1028,93 @@ public:
                    void (DeviceType::*setter)(uint8_t),
                    uint8_t minVal, uint8_t maxVal, uint8_t step)
         : _device(device), _label(label), _getter(getter), _setter(setter),
-          _min(minVal), _max(maxVal), _step(step) {
-        loadCustomChars();
+          _min(minVal), _max(maxVal), _step(step), _pending(0), _ramping(false), _lastSent(0) {
+        for (uint8_t i = 0; i < 4; i++) {
+            _barSlots[i] = CGRAMManager::instance().acquire(GLYPH_BAR[i]);
+        }
+    }
+
+    ~ValueSliderItem() override {
+        if (_ramping) (_device->*_setter)(_pending);
+        for (uint8_t i = 0; i < 4; i++) {
+            CGRAMManager::instance().release(_barSlots[i]);
+        }
     }
 
     bool relatesTo(IDevice* dev) override { return _device == dev; }
 
+    bool holdsGlyphs() const override { return true; }
+
+    uint8_t getHeight() const override { return 2; }
+
     void draw(uint8_t row, bool selected) override {
-        LCD_set_cursor(0, row);
-        
-        printLabel(_label);
-        LCD_write_str(": ");
-        
-        uint8_t val = (_device->*_getter)();
-        char buf[5];
-        itoa(val, buf, 10);
-        LCD_write_str(buf);
-        
-        uint8_t cursor_pos = strlen_P(reinterpret_cast<const char*>(_label)) + 2 + strlen(buf);
-        while (cursor_pos < 20) {
-            LCD_write_char(' ');
-            cursor_pos++;
-        }
+        char line[LCD_COLS];
+        uint8_t n = TextFormat::putLabel(line, LCD_COLS - 4, _label);
+        if (n < LCD_COLS - 4) line[n] = ':';
+        writeRow(row, line, LCD_COLS - 4);
+        drawValue(row, selected);
+    }
+
+    void drawValue(uint8_t row, bool selected) override {
+        static_cast<void>(selected);
+        char line[LCD_COLS];
+        uint8_t val = shownValue();
+
+        TextFormat::putUInt(line, 4, val);
+        writeCells(LCD_COLS - 4, row, line, 4);
 
-        LCD_set_cursor(0, row + 1);
-        
         uint16_t totalPixels = map(val, _min, _max, 0, 100);
         uint8_t fullBlocks = totalPixels / 5;
         uint8_t partialPixels = totalPixels % 5;
-        
-        for (uint8_t i = 0; i < fullBlocks && i < 20; i++) {
-            LCD_write_char(0xFF);
-        }
-        
-        if (fullBlocks < 20 && partialPixels > 0) {
-            LCD_write_char(partialPixels - 1);
-            fullBlocks++;
-        }
-        
-        for (uint8_t i = fullBlocks; i < 20; i++) {
-            LCD_write_char(' ');
+
+        for (uint8_t i = 0; i < LCD_COLS; i++) {
+            if (i < fullBlocks) {
+                line[i] = static_cast<char>(0xFF);
+            } else if (i == fullBlocks && partialPixels > 0 && _barSlots[partialPixels - 1] != CGRAMManager::NO_SLOT) {
+                line[i] = static_cast<char>(_barSlots[partialPixels - 1]);
+            } else {
+                line[i] = ' ';
+            }
         }
+        writeRow(row + 1, line, LCD_COLS);
     }
 
     bool handleInput(InputEvent event) override {
-        uint8_t current = (_device->*_getter)();
-        
+        if (event == InputEvent::RELEASE) {
+            if (!_ramping) return false;
+            _ramping = false;
+            (_device->*_setter)(_pending);
+            return true;
+        }
+        if (event != InputEvent::UP && event != InputEvent::DOWN) return false;
+
+        uint8_t repeat = NavigationManager::instance().getRepeatStep();
+        uint8_t current = shownValue();
+        uint16_t step = static_cast<uint16_t>(_step) * (repeat ? repeat : 1);
+        uint8_t newVal;
+
         if (event == InputEvent::UP) {
-            uint8_t newVal;
-            if (current > _max - _step) {
-                newVal = _max;
-            } else {
-                newVal = current + _step;
-            }
+            newVal = (current + step > _max) ? _max : static_cast<uint8_t>(current + step);
+        } else {
+            newVal = (current < _min + step) ? _min : static_cast<uint8_t>(current - step);
+        }
+
+        if (repeat == 0) {
+            _ramping = false;
             (_device->*_setter)(newVal);
-            return true;
-            
-        } else if (event == InputEvent::DOWN) {
-            uint8_t newVal;
-            if (current < _min + _step) {
-                newVal = _min;
-            } else {
-                newVal = current - _step;
+        } else {
+            _pending = newVal;
+            if (!_ramping || millis() - _lastSent >= SEND_INTERVAL_MS) {
+                (_device->*_setter)(newVal);
+                _lastSent = millis();
             }
-            (_device->*_setter)(newVal);
-            return true;
+            _ramping = true;
         }
-        
-        return false;
+        return true;
     }
+    uint16_t footprint() const override { return sizeof(*this); }
 };
 
-template<typename DeviceType>
-bool ValueSliderItem<DeviceType>::_customCharsLoaded = false;
-
 /**
  * @brief Helper factory for slider creation with type deduction
  * @ingroup UI
@@ -425,27 +1148,34 @@ private:
     const __FlashStringHelper* _unit;
     bool _isTemperature;
     IDevice* _device;
+    int16_t _shownValue;  ///< Value currently on the LCD
+
+    static constexpr uint8_t NUMBER_COL = 10;   ///< First cell of the number field
+    static constexpr uint8_t NUMBER_WIDTH = 5;  ///< Right-aligned number width
+    static constexpr uint8_t UNIT_COL = 16;     ///< First cell of the 3-char unit field
+
+    /**
+     * @brief Formats number, separator and unit into cells 10-18 of a row
+     * @param line Row buffer
+     */
+    void formatValue(char* line) {
+        _shownValue = (_object->*_getter)();
+        formatNumber(line + NUMBER_COL, _shownValue);
+        line[UNIT_COL - 1] = _isTemperature ? static_cast<char>(0xDF) : ' ';
+        TextFormat::putLabel(line + UNIT_COL, MENU_ITEM_COLS - UNIT_COL, _unit);
+    }
 
-    void printValue(int16_t value) {
-        char buf[8];
+    /**
+     * @brief Formats just the number field
+     * @param cells NUMBER_WIDTH cells
+     * @param value Value to print
+     */
+    void formatNumber(char* cells, int16_t value) {
         if (_isTemperature) {
-            int16_t whole = value / 10;
-            int16_t decimal = abs(value % 10);
-            
-            itoa(whole, buf, 10);
-            LCD_write_str(buf);
-            LCD_write_char('.');
-            
-            buf[0] = '0' + decimal;
-            buf[1] = '\0';
-            LCD_write_str(buf);
-            LCD_write_char(0xDF);
+            TextFormat::putDeci(cells, NUMBER_WIDTH, value);
         } else {
-            itoa(value, buf, 10);
-            LCD_write_str(buf);
-            LCD_write_char(' ');
+            TextFormat::putInt(cells, NUMBER_WIDTH, value);
         }
-        printLabel(_unit);
     }
 
 public:
@@ -456,11 +1186,12 @@ public:
      * @param getter Member function returning int16_t value
      * @param unit Unit string
      * @param isTemp True for temperature formatting
+     * @param source Device whose events refresh the value (optional)
      */
     LiveItem(const __FlashStringHelper* label, T* object, int16_t (T::*getter)() const,
-             const __FlashStringHelper* unit, bool isTemp = false)
+             const __FlashStringHelper* unit, bool isTemp = false, IDevice* source = nullptr)
         : _label(label), _object(object), _getter(getter), _unit(unit), 
-          _isTemperature(isTemp), _device(nullptr) {}
+          _isTemperature(isTemp), _device(source), _shownValue(0) {}
 
     /**
      * @brief Constructs live item for sensor display
@@ -473,27 +1204,31 @@ public:
     LiveItem(IDevice* device, T* object, int16_t (T::*getter)() const,
              const __FlashStringHelper* unit, bool isTemp = false)
         : _label(nullptr), _object(object), _getter(getter), _unit(unit),
-          _isTemperature(isTemp), _device(device) {}
+          _isTemperature(isTemp), _device(device), _shownValue(0) {}
 
     bool relatesTo(IDevice* dev) override { return _device == dev; }
 
     void draw(uint8_t row, bool selected) override {
-        LCD_set_cursor(0, row);
-        LCD_write_str(selected ? "> " : "  ");
-        
-        if (_label) {
-            printLabel(_label);
-        } else if (_device) {
-            printLabel(_device->name);
-        }
-        
-        LCD_write_str(": ");
-        
+        char line[MENU_ITEM_COLS];
+        putCursor(line, selected);
+        TextFormat::putLabel(line + 2, NUMBER_COL - 2, _label ? _label : (_device ? _device->name : nullptr));
+        formatValue(line);
+        writeRow(row, line, MENU_ITEM_COLS);
+    }
+
+    void drawValue(uint8_t row, bool selected) override {
+        static_cast<void>(selected);
         int16_t value = (_object->*_getter)();
-        printValue(value);
+        if (value == _shownValue) return;
+
+        char cells[NUMBER_WIDTH];
+        _shownValue = value;
+        formatNumber(cells, value);
+        writeCells(NUMBER_COL, row, cells, NUMBER_WIDTH);
     }
 
     bool handleInput(InputEvent event) override { return false; }
+    uint16_t footprint() const override { return sizeof(*this); }
 };
 
 /**
@@ -506,9 +1241,10 @@ LiveItem<T>* makeLiveItem(
     T* object,
     int16_t (T::*getter)() const,
     const __FlashStringHelper* unit,
-    bool isTemp = false
+    bool isTemp = false,
+    IDevice* source = nullptr
 ) {
-    return new LiveItem<T>(label, object, getter, unit, isTemp);
+    return new LiveItem<T>(label, object, getter, unit, isTemp, source);
 }
 
 /**
@@ -526,6 +1262,37 @@ LiveItem<T>* makeLiveItem(
     return new LiveItem<T>(device, object, getter, unit, isTemp);
 }
 
+/**
+ * @brief One page of the UI latency breakdown: title, average and max
+ * @ingroup UI
+ */
+class PageLatencyItem : public MenuItem {
+private:
+    UiLatencySensorDevice* _sensor;
+    uint8_t _slot;  ///< UiLatencySensor page slot
+
+    static constexpr uint8_t VALUE_COL = 11;  ///< First cell of "avg/max"
+
+    /**
+     * @brief Formats "avg/max" into cells VALUE_COL to MENU_ITEM_COLS - 1
+     * @param cells Output cells
+     */
+    void formatValue(char* cells) const;
+
+public:
+    /**
+     * @brief Constructs a breakdown row
+     * @param sensor Latency sensor device
+     * @param slot Page slot to show
+     */
+    PageLatencyItem(UiLatencySensorDevice* sensor, uint8_t slot);
+
+    bool relatesTo(IDevice* dev) override;
+    void draw(uint8_t row, bool selected) override;
+    void drawValue(uint8_t row, bool selected) override;
+    uint16_t footprint() const override { return sizeof(*this); }
+};
+
 /**
  * @brief Specialized live display for PIR motion sensors
  * @ingroup UI
@@ -543,7 +1310,9 @@ public:
 
     bool relatesTo(IDevice* dev) override;
     void draw(uint8_t row, bool selected) override;
+    void drawValue(uint8_t row, bool selected) override;
     bool handleInput(InputEvent event) override;
+    uint16_t footprint() const override { return sizeof(*this); }
 };
 
 /**
@@ -567,6 +1336,7 @@ public:
 
     void draw(uint8_t row, bool selected) override;
     bool handleInput(InputEvent event) override;
+    uint16_t footprint() const override { return sizeof(*this); }
 };
 
 /**
@@ -592,6 +1362,8 @@ public:
 
     void draw(uint8_t row, bool selected) override;
     bool handleInput(InputEvent event) override;
+    const __FlashStringHelper* getLabel(uint8_t& col, uint8_t& width) const override;
+    uint16_t footprint() const override { return sizeof(*this); }
 };
 
 /**
@@ -615,8 +1387,16 @@ public:
 
     MenuItemType getType() const override;
     MenuPage* createPage() const;
+
+    /**
+     * @brief Builds the submenu page ahead of ENTER
+     */
+    void prefetchPage() const;
+
     void draw(uint8_t row, bool selected) override;
     bool handleInput(InputEvent event) override;
+    const __FlashStringHelper* getLabel(uint8_t& col, uint8_t& width) const override;
+    uint16_t footprint() const override { return sizeof(*this); }
 };
 
 /**
@@ -629,6 +1409,7 @@ public:
     
     void draw(uint8_t row, bool selected) override;
     bool handleInput(InputEvent event) override;
+    uint16_t footprint() const override { return sizeof(*this); }
 };
 
 /**
@@ -647,7 +1428,109 @@ public:
     explicit SceneToggleItem(IScene* scene);
 
     void draw(uint8_t row, bool selected) override;
+    void drawValue(uint8_t row, bool selected) override;
     bool handleInput(InputEvent event) override;
+    uint16_t footprint() const override { return sizeof(*this); }
+};
+
+/**
+ * @brief How a device is listed on the Lights and Sensors pages
+ * @ingroup UI
+ */
+enum class DeviceRowKind : uint8_t {
+    NONE,     ///< Not listed
+    TOGGLE,   ///< DeviceToggleItem
+    SUBMENU,  ///< SubMenuItem opening builder(device)
+    PIR       ///< LivePIRItem
+};
+
+/**
+ * @brief Menu description of one DeviceType, stored in PROGMEM
+ * @ingroup UI
+ * @details MenuBuilder keeps one row per DeviceType, indexed by the enum
+ * value, so listing a device or opening its statistics is a single lookup.
+ */
+struct DeviceMenuRow {
+    DeviceRowKind kind;                  ///< Row created for the device
+    const char* label;                   ///< Row label (PROGMEM), nullptr uses the device name
+    PageBuilder builder;                 ///< SUBMENU target
+    const char* unit;                    ///< Statistics unit (PROGMEM), nullptr if no statistics
+    SensorStats& (*stats)(IDevice*);     ///< Statistics accessor
+    bool tenths;                         ///< Values are in tenths (temperature)
+};
+
+/**
+ * @brief Creates the row for a device in caller-provided storage
+ * @param device Device from DeviceRegistry
+ * @param storage DeviceListPage::ROW_BYTES bytes for placement new
+ * @return Row item, or nullptr if the device is not part of the list
+ */
+typedef MenuItem* (*RowGenerator)(IDevice* device, void* storage);
+
+/**
+ * @brief Device list whose rows are generated only when needed
+ * @ingroup UI
+ *
+ * Holds no item objects. Each access builds the requested row in an
+ * in-page slot, so the page costs the same RAM with 3 devices or 50. A
+ * registry cursor remembers where the last row was found, so the ascending
+ * walks of drawing and event checks step one device at a time. The selected
+ * row handling input gets its own slot: it may raise events that rebuild
+ * the drawing slot while it runs. A "<< Back" row is appended. Generated
+ * items must be single-row; a slot's previous item is destroyed before
+ * the slot is reused.
+ */
+class DeviceListPage : public MenuPage {
+public:
+    /// Largest row type a generator may build
+    static constexpr size_t ROW_BYTES =
+        sizeof(SubMenuItem) > sizeof(DeviceToggleItem) ? sizeof(SubMenuItem) : sizeof(DeviceToggleItem);
+
+private:
+    RowGenerator _generator;                  ///< Device-to-row mapping
+    uint8_t _count;                           ///< Generated rows (Back excluded)
+    uint8_t _cursorRow;                       ///< Row found by the last lookup
+    uint8_t _cursorDevice;                    ///< Registry index of _cursorRow
+    MenuItem* _rowItem;                       ///< Live item in _row, or nullptr
+    MenuItem* _inputItem;                     ///< Live item in _input, or nullptr
+    alignas(void*) uint8_t _row[ROW_BYTES];   ///< Storage for the current transient row
+    alignas(void*) uint8_t _input[ROW_BYTES]; ///< Storage for the row handling input
+
+    /**
+     * @brief Checks if the generator lists a device
+     * @param device Device from DeviceRegistry
+     * @param slot Scratch slot, left empty
+     * @return True if the device has a row
+     */
+    bool lists(IDevice* device, uint8_t* slot) const;
+
+    /**
+     * @brief Builds a row into a slot, destroying the slot's previous item
+     * @param index Row index
+     * @param slot Row storage
+     * @param live Item currently in slot; receives the new one
+     * @return Row item, or nullptr if out of range
+     */
+    MenuItem* buildRow(size_t index, uint8_t* slot, MenuItem*& live);
+
+protected:
+    MenuItem* itemAt(size_t index) override;
+    MenuItem* inputItem() override;
+    uint8_t getRowHeight(size_t index) const override;
+
+public:
+    /**
+     * @brief Constructs the list and counts the matching devices
+     * @param title Flash string title
+     * @param generator Row generator
+     * @param parent Parent page
+     */
+    DeviceListPage(const __FlashStringHelper* title, RowGenerator generator, MenuPage* parent);
+
+    ~DeviceListPage() override;
+
+    size_t getItemsCount() const override;
+    uint16_t footprint() const override { return sizeof(*this) + itemsFootprint(); }
 };
 
 /**
@@ -655,12 +1538,46 @@ public:
  * @ingroup UI
  * 
  * Provides static builder functions that create menu pages on-demand.
+ * Menus with fixed content are PROGMEM tables opened as TablePage.
  */
 class MenuBuilder {
 private:
     static void setOutsideModeAction(IDevice* d, int v);
     static void setRGBPresetAction(IDevice* d, int v);
 
+    static MenuItem* deviceRow(IDevice* d, void* storage);
+    static MenuItem* lightRow(IDevice* d, void* storage);
+    static MenuItem* sensorRow(IDevice* d, void* storage);
+    static bool readDeviceRow(DeviceType type, DeviceMenuRow& row);
+
+    /**
+     * @brief Statistics accessor for DEVICE_ROWS
+     * @tparam T Sensor class exposing getStats()
+     * @param d Device of type T
+     * @return The sensor's statistics
+     */
+    template<typename T>
+    static SensorStats& statsOf(IDevice* d) { return static_cast<T*>(d)->getStats(); }
+
+    static int16_t readTemperature(IDevice* d);
+    static int16_t readLightLevel(IDevice* d);
+    static int16_t readActiveScenes(IDevice* d);
+    static int16_t readLoopTime(IDevice* d);
+    static int16_t readFreeRam(IDevice* d);
+
+    static const MenuEntry CUSTOM_COLOR_ENTRIES[];
+    static const MenuEntry RGB_PRESET_ENTRIES[];
+    static const MenuEntry OUTSIDE_MODE_ENTRIES[];
+    static const MenuEntry OUTSIDE_LIGHT_ENTRIES[];
+    static const MenuEntry MAIN_MENU_ENTRIES[];
+    static const DashboardTile DASHBOARD_TILES[];
+    static const DeviceMenuRow DEVICE_ROWS[];
+    static const MenuTable CUSTOM_COLOR_MENU;
+    static const MenuTable RGB_PRESETS_MENU;
+    static const MenuTable OUTSIDE_MODES_MENU;
+    static const MenuTable OUTSIDE_LIGHT_MENU;
+    static const MenuTable MAIN_MENU;
+
 public:
     static MenuPage* buildRedPage(void* context);
     static MenuPage* buildGreenPage(void* context);
@@ -670,13 +1587,15 @@ public:
     static MenuPage* buildRGBPresetsPage(void* context);
     static MenuPage* buildRGBLightPage(void* context);
     static MenuPage* buildDimmableLightPage(void* context);
-    static MenuPage* buildOutsideModesPage(void* context);
     static MenuPage* buildOutsideLightPage(void* context);
     static MenuPage* buildLightsPage(void* context);
     static MenuPage* buildSensorStatsPage(void* context);
+    static MenuPage* buildLatencyPage(void* context);
     static MenuPage* buildLightSettingsPage(void* context);
     static MenuPage* buildSensorsPage(void* context);
     static MenuPage* buildScenesPage(void* context);
+    static MenuPage* buildHomePage(void* context);
+    static MenuPage* buildDashboardPage(void* context);
     
     /**
      * @brief Builds root menu page
@@ -5,9 +5,12 @@
  * @version 2.0
  * 
  * @details Provides abstraction for physical input devices:
+ * - Port-wide vertical-counter debouncing for all buttons
+ * - Click, double-click, long-press and hold-repeat gestures
  * - Push buttons with debouncing
- * - Potentiometers with smoothing
+ * - Potentiometers with smoothing and hysteresis
  * - Navigation buttons for menu control
+ * - Modulino Knob rotary encoder for menu control
  * 
  * @ingroup HAL
  */
@@ -15,6 +18,7 @@
 #define PHYSICAL_INPUT_H
 
 #include "CoreSystem.h"
+#include "modulinoknob.h"
 
 class SimpleLight;
 class DimmableLight;
@@ -29,24 +33,246 @@ enum class ButtonMode : uint8_t {
     ACTIVE_HIGH   ///< Button connects to VCC when pressed (external pull-down)
 };
 
+/**
+ * @class InputScanner
+ * @brief Singleton debouncing every button pin with vertical counters
+ * @ingroup HAL
+ *
+ * @details Once per SCAN_INTERVAL_MS each watched port register (PINB, PINC,
+ * PIND) is read once and all of its pins are debounced in parallel: two
+ * bytes per port form eight 2-bit counters, and a pin changes its debounced
+ * state after four consecutive samples disagree with it. Each scan yields
+ * press and release bitmasks that the button objects test with their mask.
+ *
+ * Pin-change interrupts keep two jobs: they wake the scanner, so nothing is
+ * sampled while all buttons rest, and they latch a pin that became active so
+ * a tap released before four samples were taken still registers. Latches are
+ * ignored for HOLDOFF_SCANS scans after a release, so contact bounce on the
+ * way up cannot force a second press past the counters.
+ */
+class InputScanner {
+public:
+    static constexpr uint8_t PORTS = 3;             ///< PCINT groups: B, C, D
+    static constexpr uint8_t SCAN_INTERVAL_MS = 5;  ///< Sample period (4 samples = 20 ms)
+    static constexpr uint8_t HOLDOFF_SCANS = 4;     ///< Scans after a release without latching
+
+private:
+    /**
+     * @brief Debounce state of one port
+     */
+    struct Port {
+        uint8_t watched;    ///< Button pins on this port
+        uint8_t activeLow;  ///< Watched pins that read LOW when pressed
+        uint8_t state;      ///< Debounced state, 1 = pressed
+        uint8_t count0;     ///< Vertical counter, low bit
+        uint8_t count1;     ///< Vertical counter, high bit
+        uint8_t pressed;    ///< Pins that became pressed in the last scan
+        uint8_t released;   ///< Pins that became released in the last scan
+        volatile uint8_t latched;  ///< Pins seen active by the ISR since the last press
+        uint8_t holdoff;    ///< Released pins the ISR must not latch yet
+        uint8_t holdoffScans;  ///< Scans left before holdoff is cleared
+    };
+
+    Port _ports[PORTS];          ///< Per-port state
+    volatile bool _activity;     ///< A pin changed since the scanner went to rest
+    bool _counting;              ///< Some counter has not settled yet
+    uint8_t _lastScan;           ///< millis() of the last scan, truncated
+
+    /**
+     * @brief Private constructor for singleton pattern
+     */
+    InputScanner();
+
+    /**
+     * @brief Reads the input register of a port
+     * @param port PCINT group (0-2)
+     * @return Port input register
+     */
+    static uint8_t readPort(uint8_t port);
+
+public:
+    /**
+     * @brief Gets singleton instance
+     * @return Reference to InputScanner instance
+     */
+    static InputScanner& instance();
+
+    /**
+     * @brief Configures a button pin and adds it to the scan
+     * @param pin Arduino pin number
+     * @param mode Button wiring configuration
+     * @param port Receives the PCINT group of the pin
+     * @param mask Receives the bit of the pin in the port register
+     */
+    void watch(uint8_t pin, ButtonMode mode, uint8_t& port, uint8_t& mask);
+
+    /**
+     * @brief Samples all ports if a scan is due
+     * @return True if any pin changed its debounced state
+     * @note Clears the previous press/release masks on every call, so they
+     * are valid only until the next call.
+     */
+    bool scan();
+
+    /**
+     * @brief Gets the pins that became pressed in the last scan
+     * @param port PCINT group (0-2)
+     * @return Bitmask in port register order
+     */
+    uint8_t pressed(uint8_t port) const { return _ports[port].pressed; }
+
+    /**
+     * @brief Gets the pins that became released in the last scan
+     * @param port PCINT group (0-2)
+     * @return Bitmask in port register order
+     */
+    uint8_t released(uint8_t port) const { return _ports[port].released; }
+
+    /**
+     * @brief Gets the debounced state of a port
+     * @param port PCINT group (0-2)
+     * @return Bitmask of pressed pins
+     */
+    uint8_t held(uint8_t port) const { return _ports[port].state; }
+
+    /**
+     * @brief Notes a pin change; called only from the PCINT handlers
+     * @param port PCINT group (0-2)
+     * @param levels Port input register read by the handler
+     */
+    void onPinChange(uint8_t port, uint8_t levels);
+};
+
+/**
+ * @brief Gesture reported by GestureRecognizer
+ * @ingroup HAL
+ */
+enum class ButtonGesture : uint8_t {
+    NONE,          ///< Nothing happened
+    PRESS,         ///< Debounced press edge (always reported)
+    CLICK,         ///< Short press, confirmed once no double-click can follow
+    DOUBLE_CLICK,  ///< Two short presses within DOUBLE_CLICK_MS
+    LONG_PRESS,    ///< Held for LONG_PRESS_MS
+    REPEAT,        ///< Auto-repeat while held
+    RELEASE        ///< Let go after a long press or repeats
+};
+
+/**
+ * @class GestureRecognizer
+ * @brief Timestamp-driven click, double-click, long-press and hold-repeat detection
+ * @ingroup HAL
+ *
+ * @details Fed with debounced press/release edges and polled in between for
+ * the time-based gestures. Gestures not enabled cost no latency: without
+ * DOUBLE_CLICK a click is reported on release, and without LONG_PRESS or
+ * REPEAT holding a key reports nothing until it is released.
+ * Repeats start after REPEAT_DELAY_MS (or after the long press) with an
+ * interval shrinking from REPEAT_START_MS to REPEAT_MIN_MS.
+ */
+class GestureRecognizer {
+public:
+    static constexpr uint8_t DOUBLE_CLICK = 0x01;  ///< Option: detect double-clicks
+    static constexpr uint8_t LONG_PRESS = 0x02;    ///< Option: detect long presses
+    static constexpr uint8_t REPEAT = 0x04;        ///< Option: auto-repeat while held
+
+private:
+    uint8_t _options;      ///< Enabled gestures
+    bool _down;            ///< Key currently pressed
+    bool _held;            ///< Long press or first repeat already reported
+    uint8_t _clicks;       ///< Short presses awaiting the double-click window
+    uint8_t _repeats;      ///< Repeats reported during this hold
+    uint16_t _pressAt;     ///< Stamp of the last press (truncated millis)
+    uint16_t _releaseAt;   ///< Stamp of the last release
+    uint16_t _nextRepeat;  ///< Stamp of the next repeat
+    static constexpr uint16_t LONG_PRESS_MS = 600;    ///< Hold time of a long press
+    static constexpr uint16_t DOUBLE_CLICK_MS = 250;  ///< Max gap between two clicks
+    static constexpr uint16_t REPEAT_DELAY_MS = 400;  ///< Hold time before repeating
+    static constexpr uint8_t REPEAT_START_MS = 150;   ///< First repeat interval
+    static constexpr uint8_t REPEAT_MIN_MS = 40;      ///< Fastest repeat interval
+
+public:
+    /**
+     * @brief Constructor
+     * @param options Bitwise OR of DOUBLE_CLICK, LONG_PRESS and REPEAT
+     */
+    explicit GestureRecognizer(uint8_t options = 0)
+        : _options(options), _down(false), _held(false), _clicks(0), _repeats(0),
+          _pressAt(0), _releaseAt(0), _nextRepeat(0) {}
+
+    /**
+     * @brief Changes the enabled gestures
+     * @param options Bitwise OR of DOUBLE_CLICK, LONG_PRESS and REPEAT
+     */
+    void setOptions(uint8_t options) { _options = options; }
+
+    /**
+     * @brief Gets the enabled gestures
+     * @return Option bits
+     */
+    uint8_t getOptions() const { return _options; }
+
+    /**
+     * @brief Feeds a debounced press
+     * @param now Truncated millis()
+     * @return PRESS, or DOUBLE_CLICK for the second press of a pair
+     */
+    ButtonGesture press(uint16_t now);
+
+    /**
+     * @brief Feeds a debounced release
+     * @param now Truncated millis()
+     * @return CLICK, RELEASE or NONE
+     */
+    ButtonGesture release(uint16_t now);
+
+    /**
+     * @brief Reports gestures that depend only on elapsed time
+     * @param now Truncated millis()
+     * @return CLICK, LONG_PRESS, REPEAT or NONE
+     * @note Call every loop; returns at once when nothing is pending
+     */
+    ButtonGesture poll(uint16_t now);
+
+    /**
+     * @brief Checks whether poll() can report anything
+     * @return True while the key is down or a click awaits confirmation
+     */
+    bool isActive() const { return _down || _clicks > 0; }
+
+    /**
+     * @brief Gets the repeats reported during the current hold
+     * @return Repeat count (saturates at 255)
+     */
+    uint8_t getRepeats() const { return _repeats; }
+};
+
+/**
+ * @brief Callback for gestures other than a click
+ * @param gesture DOUBLE_CLICK or LONG_PRESS
+ * @param device Device linked to the button (may be nullptr)
+ */
+typedef void (*GestureHandler)(ButtonGesture gesture, IDevice* device);
+
 /**
  * @class ButtonInput
  * @brief Debounced button input handler with device linking
  * @ingroup HAL
  * 
- * @details Handles physical button presses with software debouncing.
- * Can be linked to a device to emit ButtonPressed events when pressed.
+ * @details Handles physical button presses reported by InputScanner.
+ * Can be linked to a device to emit ButtonPressed events when clicked.
+ * Without a gesture handler the event is sent on press; with one, a click
+ * is confirmed on release and long presses or double-clicks go to the
+ * handler instead.
  * Implements IEventListener to react to linked device state changes.
  */
 class ButtonInput : public IEventListener {
 private:
-    uint8_t _pin;                    ///< Arduino pin number
+    uint8_t _port;                   ///< InputScanner port of the pin
+    uint8_t _mask;                   ///< Bit of the pin in that port
     uint8_t _buttonId;               ///< Unique button identifier
-    bool _lastState;                 ///< Previous debounced state
-    unsigned long _lastDebounceTime; ///< Timestamp of last state change
     IDevice* _linkedDevice;          ///< Device controlled by this button
-    ButtonMode _mode;                ///< Wiring configuration
-    static const uint8_t DEBOUNCE_DELAY = 50;  ///< Debounce time in milliseconds
+    GestureRecognizer _gestures;     ///< Click/long-press detection
+    GestureHandler _handler;         ///< Receives non-click gestures (optional)
 
 public:
     /**
@@ -60,10 +286,17 @@ public:
                 ButtonMode mode = ButtonMode::ACTIVE_LOW);
     
     /**
-     * @brief Periodic update - reads and debounces button state
-     * @note Call from main loop
+     * @brief Acts on the last scan and on timed gestures
+     * @note Call from main loop after InputScanner::scan()
      */
     void update();
+
+    /**
+     * @brief Routes long presses and/or double-clicks to a handler
+     * @param handler Callback receiving the gestures
+     * @param options GestureRecognizer::LONG_PRESS and/or DOUBLE_CLICK
+     */
+    void setGestureHandler(GestureHandler handler, uint8_t options = GestureRecognizer::LONG_PRESS);
     
     /**
      * @brief Called when valid button press is detected
@@ -97,19 +330,22 @@ public:
  * @brief Smoothed potentiometer input with light control
  * @ingroup HAL
  * 
- * @details Reads analog potentiometer with averaging and threshold
- * filtering to control dimmable light brightness smoothly.
+ * @details Samples arrive from AnalogSampler at a fixed rate and feed an
+ * exponential moving average kept as a running sum of 2^FILTER_SHIFT
+ * samples, so each one costs a shift and two adds. The average is
+ * quantised to brightness 0-100 in 1/256 level units, and the level only
+ * moves once the input leaves the current level's band by HYSTERESIS,
+ * so a pot resting on a boundary no longer flickers between two levels.
  */
 class PotentiometerInput {
 private:
-    uint8_t _pin;                    ///< Arduino analog pin number
+    uint8_t _slot;                   ///< AnalogSampler slot of the pin
     DimmableLight* _light;           ///< Linked dimmable light
-    uint8_t _lastMappedValue;        ///< Last applied brightness value
-    static constexpr uint8_t SAMPLE_COUNT = 8;        ///< Averaging sample count
+    uint8_t _level;                  ///< Last applied brightness value
+    uint16_t _sum;                   ///< Moving average scaled by 2^FILTER_SHIFT
+    static constexpr uint8_t FILTER_SHIFT = 3;        ///< Average over ~8 samples
     static constexpr uint8_t POT_OFF_THRESHOLD = 5;   ///< Threshold below which light turns off
-    static constexpr uint8_t POT_CHANGE_THRESHOLD = 3; ///< Minimum change to update
-    uint16_t _samples[SAMPLE_COUNT]; ///< Circular buffer for averaging
-    uint8_t _sampleIndex;            ///< Current position in sample buffer
+    static constexpr uint8_t HYSTERESIS = 96;         ///< Extra travel to leave a level (1/256 level)
 
 public:
     /**
@@ -120,8 +356,8 @@ public:
     explicit PotentiometerInput(uint8_t pin, DimmableLight* linkedLight = nullptr);
     
     /**
-     * @brief Periodic update - reads and applies potentiometer value
-     * @note Call from main loop. Non-blocking.
+     * @brief Periodic update - filters a new sample and applies the level
+     * @note Call from main loop after AnalogSampler::update(). Non-blocking.
      */
     void update();
     
@@ -143,17 +379,25 @@ public:
  * @brief Navigation button for menu control
  * @ingroup HAL
  * 
- * @details Dedicated button input for menu navigation.
- * Sends strongly-typed InputEvent commands to NavigationManager.
+ * @details Dedicated button input for menu navigation, debounced by
+ * InputScanner. Queues strongly-typed InputEvent commands in InputQueue for
+ * NavigationManager to process in the UI stage.
+ * UP and DOWN auto-repeat while held through GestureRecognizer::REPEAT, and
+ * the step multiplier grows from 1 to 4 with the repeat count. Letting go
+ * after at least one repeat sends InputEvent::RELEASE.
  */
 class NavButtonInput {
 private:
-    uint8_t _pin;                    ///< Arduino pin number
+    uint8_t _port;                   ///< InputScanner port of the pin
+    uint8_t _mask;                   ///< Bit of the pin in that port
     InputEvent _command;             ///< Navigation command to send
-    bool _lastState;                 ///< Previous debounced state
-    unsigned long _lastDebounceTime; ///< Timestamp of last state change
-    ButtonMode _mode;                ///< Wiring configuration
-    static const uint8_t DEBOUNCE_DELAY = 50;  ///< Debounce time in milliseconds
+    GestureRecognizer _gestures;     ///< Hold-repeat detection (UP/DOWN)
+
+    /**
+     * @brief Gets the step multiplier for the current repeat
+     * @return 1, 2 or 4 depending on how long the key has been held
+     */
+    uint8_t repeatStep() const;
 
 public:
     /**
@@ -163,10 +407,84 @@ public:
      * @param mode Button wiring configuration
      */
     NavButtonInput(uint8_t pin, InputEvent command, ButtonMode mode = ButtonMode::ACTIVE_LOW);
-    
+
+    /**
+     * @brief Periodic update - acts on the last scan and auto-repeats
+     * @note Call from main loop after InputScanner::scan()
+     */
+    void update();
+};
+
+/**
+ * @class KnobInput
+ * @brief Modulino Knob rotary encoder as a navigation input
+ * @ingroup HAL
+ *
+ * @details Reads the knob's counter and button over I2C and queues
+ * InputEvent commands like NavButtonInput does, so one knob can stand in
+ * for the four navigation buttons: turning sends DOWN (clockwise) or UP,
+ * a click sends ENTER, and a double-click or long press sends BACK. The
+ * button goes through GestureRecognizer; the module debounces it itself.
+ *
+ * Turning faster than SLOW_DETENT_MS per detent sends the detents with a
+ * step multiplier of 2, or 4 below FAST_DETENT_MS, so sliders cover their
+ * range in a fraction of a turn; RELEASE follows once the knob rests.
+ *
+ * The counter keeps counting between reads, so the read rate only decides
+ * latency: every POLL_FAST_MS while the knob is in use, POLL_AWAKE_MS while
+ * the UI is awake, and POLL_IDLE_MS while it sleeps, just often enough for
+ * a turn to wake it.
+ */
+class KnobInput {
+private:
+    ModulinoKnob _knob;              ///< I2C driver
+    GestureRecognizer _gestures;     ///< Click/double-click/long-press detection
+    int16_t _lastValue;              ///< Counter at the last read
+    bool _down;                      ///< Button state at the last read
+    bool _ramping;                   ///< Accelerated detents sent, RELEASE pending
+    bool _present;                   ///< Module answered in begin()
+    uint16_t _lastRead;              ///< Stamp of the last I2C read (truncated millis)
+    uint16_t _lastUse;               ///< Stamp of the last turn or button edge
+    static constexpr uint8_t POLL_FAST_MS = 10;       ///< Read period while in use
+    static constexpr uint8_t POLL_AWAKE_MS = 40;      ///< Read period while the UI is awake
+    static constexpr uint8_t POLL_IDLE_MS = 200;      ///< Read period while the UI sleeps
+    static constexpr uint16_t IN_USE_MS = 1000;       ///< Fast reads continue this long after use
+    static constexpr uint8_t SLOW_DETENT_MS = 60;     ///< Slower detents step by 1
+    static constexpr uint8_t FAST_DETENT_MS = 25;     ///< Faster detents step by 4
+    static constexpr uint8_t SETTLE_MS = 150;         ///< Rest that ends an accelerated turn
+    static constexpr uint8_t MAX_DETENTS = 16;        ///< Detents queued from a single read
+
+    /**
+     * @brief Gets the read period for the current state
+     * @param now Truncated millis()
+     * @return Milliseconds between I2C reads
+     */
+    uint8_t pollInterval(uint16_t now) const;
+
+    /**
+     * @brief Queues the detents turned since the last read
+     * @param delta Signed detent count (positive = clockwise)
+     * @param now Truncated millis()
+     */
+    void onTurn(int16_t delta, uint16_t now);
+
+public:
     /**
-     * @brief Periodic update - reads and processes button state
-     * @note Call from main loop
+     * @brief Constructor
+     * @note The module is not touched until begin()
+     */
+    KnobInput();
+
+    /**
+     * @brief Looks for the module on the I2C bus
+     * @return True if the knob answered
+     * @note Call from setup() after i2c_init()
+     */
+    bool begin();
+
+    /**
+     * @brief Periodic update - reads the knob when due and queues commands
+     * @note Call from main loop. Non-blocking apart from the I2C read.
      */
     void update();
 };
@@ -177,18 +495,20 @@ public:
  * @ingroup HAL
  * 
  * @details Centralized manager for all button and potentiometer inputs.
- * Provides single update point for all input processing.
+ * Provides single update point for all input processing: InputScanner
+ * debounces every button pin first, then each input is updated.
  */
 class InputManager {
 private:
     DynamicArray<ButtonInput*> _buttons;           ///< Registered button inputs
-    DynamicArray<PotentiometerInput*> _potentiometers; ///< Registered potentiometer inputs
+    DynamicArray<PotentiometerInput*> _potentiometers; ///< Registered potentiometer inputs (sampled by AnalogSampler)
     DynamicArray<NavButtonInput*> _navButtons;     ///< Registered navigation buttons
+    KnobInput* _knob;                              ///< Registered navigation knob (optional)
 
     /**
      * @brief Private constructor for singleton pattern
      */
-    InputManager() {}
+    InputManager() : _knob(nullptr) {}
 
 public:
     /**
@@ -215,6 +535,12 @@ public:
      */
     void registerNavButton(NavButtonInput* navBtn);
 
+    /**
+     * @brief Registers the navigation knob
+     * @param knob Pointer to knob input
+     */
+    void registerKnob(KnobInput* knob);
+
     /**
      * @brief Updates all registered inputs
      * @note Call from main loop. Non-blocking.
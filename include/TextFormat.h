@@ -0,0 +1,89 @@
+/**
+ * @file TextFormat.h
+ * @brief Allocation-free fixed-width text formatting for display rows
+ * @author Andrea Bortolotti
+ * @version 2.0
+ * @ingroup UI
+ *
+ * All functions write straight into a caller-provided character region of
+ * fixed width and never NUL-terminate, so a whole LCD row can be composed in
+ * one stack buffer and sent with a single write. Digits are extracted by
+ * subtracting powers of ten from a PROGMEM table instead of div/mod loops.
+ */
+#ifndef TEXT_FORMAT_H
+#define TEXT_FORMAT_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Static helpers that format values into fixed-width buffer regions
+ * @ingroup UI
+ *
+ * Numbers are right-aligned and padded with spaces. A value that does not fit
+ * its field is shown as a run of '#' rather than silently truncated.
+ */
+class TextFormat {
+public:
+    /**
+     * @brief Fills a region with a single character
+     * @param dst Destination region
+     * @param width Region width
+     * @param c Fill character
+     */
+    static void fill(char* dst, uint8_t width, char c = ' ');
+
+    /**
+     * @brief Copies a Flash string left-aligned, padding with spaces
+     * @param dst Destination region
+     * @param width Region width (longer text is clipped)
+     * @param text String in PROGMEM
+     * @return Number of characters copied before padding
+     */
+    static uint8_t putLabel(char* dst, uint8_t width, const __FlashStringHelper* text);
+
+    /**
+     * @brief Copies a RAM string left-aligned, padding with spaces
+     * @param dst Destination region
+     * @param width Region width (longer text is clipped)
+     * @param text Null-terminated string in RAM
+     * @return Number of characters copied before padding
+     */
+    static uint8_t putLabel(char* dst, uint8_t width, const char* text);
+
+    /**
+     * @brief Writes an unsigned integer right-aligned
+     * @param dst Destination region
+     * @param width Region width
+     * @param value Value to print
+     */
+    static void putUInt(char* dst, uint8_t width, uint16_t value);
+
+    /**
+     * @brief Writes a signed integer right-aligned
+     * @param dst Destination region
+     * @param width Region width (sign included)
+     * @param value Value to print
+     */
+    static void putInt(char* dst, uint8_t width, int16_t value);
+
+    /**
+     * @brief Writes a decicelsius value as "-12.3", right-aligned
+     * @param dst Destination region
+     * @param width Region width (sign and point included)
+     * @param deci Value in tenths
+     */
+    static void putDeci(char* dst, uint8_t width, int16_t deci);
+
+private:
+    /**
+     * @brief Right-aligns a digit string with optional sign and decimal point
+     * @param dst Destination region
+     * @param width Region width
+     * @param magnitude Absolute value
+     * @param negative True to prefix '-'
+     * @param decimals 0 for integers, 1 to insert a point before the last digit
+     */
+    static void putNumber(char* dst, uint8_t width, uint16_t magnitude, bool negative, uint8_t decimals);
+};
+
+#endif
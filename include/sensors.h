@@ -9,7 +9,7 @@
  * - LM75 I2C temperature sensor
  * - Analog photoresistor
  * - HC-SR501 PIR motion sensor
- * - Virtual sensors (RAM, VCC, Loop Time)
+ * - Virtual sensors (RAM, VCC, Loop Time, LCD Traffic)
  * 
  * @note This file must remain header-only due to template classes.
  * 
@@ -22,6 +22,8 @@
 #include "DebugConfig.h"
 #include "i2cmaster.h"
 #include "MemoryMonitor.h"
+#include "Display.h"
+#include "AnalogSampler.h"
 
 /**
  * @class Sensor
@@ -166,7 +168,10 @@ public:
      * @brief Gets raw ADC reading
      * @return Raw value 0-1023
      */
-    int getRaw() const { return analogRead(_pin); }
+    int getRaw() const {
+        AnalogSampler::instance().claim();
+        return analogRead(_pin);
+    }
     
     /**
      * @brief Sets minimum calibration value
@@ -263,6 +268,7 @@ public:
      * @return VCC in millivolts (e.g., 5000 for 5.0V)
      */
     int16_t getValue() const override {
+        AnalogSampler::instance().claim();
         uint8_t savedADMUX = ADMUX;
         
 #if defined(__AVR_ATmega32U4__)
@@ -326,10 +332,10 @@ public:
     
     /**
      * @brief Gets the maximum loop time from last window
-     * @return Loop time in microseconds
+     * @return Loop time in microseconds, clamped to INT16_MAX
      */
     int16_t getValue() const override {
-        return static_cast<int16_t>(_reportedMax);
+        return _reportedMax > INT16_MAX ? INT16_MAX : static_cast<int16_t>(_reportedMax);
     }
     
     /**
@@ -346,4 +352,130 @@ public:
     }
 };
 
+/**
+ * @class LcdTrafficSensor
+ * @brief Virtual sensor for display I2C bus traffic
+ * @ingroup Devices
+ *
+ * @details Reads the cumulative byte counter kept by the active display
+ * backend (address and data bytes of every transfer; with LCD_PARALLEL,
+ * one per command or character byte, i.e. per two nibbles strobed).
+ */
+class LcdTrafficSensor : public Sensor<uint32_t> {
+public:
+    /**
+     * @brief Constructor
+     */
+    LcdTrafficSensor() : Sensor<uint32_t>() {}
+
+    /**
+     * @brief Gets total bytes moved over I2C by the display
+     * @return Byte count since boot
+     */
+    uint32_t getValue() const override {
+        return IDisplay::instance().busBytes();
+    }
+};
+
+/**
+ * @class UiLatencySensor
+ * @brief Virtual sensor for input-to-display latency
+ * @ingroup Devices
+ *
+ * @details NavigationManager reports, for each navigation input, the time
+ * from detection to the moment the resulting change was flushed to the
+ * display. Min, max and average are exact; p95 comes from a 16-bucket
+ * histogram and reports the upper edge of its bucket. A per-page table
+ * keeps count, average and max for the PAGE_SLOTS most used pages.
+ */
+class UiLatencySensor : public Sensor<int16_t> {
+public:
+    static constexpr uint8_t PAGE_SLOTS = 6;  ///< Pages tracked individually
+
+    /**
+     * @brief Latency summary for one page
+     */
+    struct PageLatency {
+        const __FlashStringHelper* title;  ///< Page title (nullptr = unused slot)
+        uint16_t count;                    ///< Samples
+        uint16_t max;                      ///< Worst latency in ms
+        uint32_t sum;                      ///< Sum of latencies in ms
+    };
+
+private:
+    static UiLatencySensor* _instance;        ///< Singleton instance pointer
+    static constexpr uint8_t BUCKETS = 16;    ///< Histogram buckets
+    static const uint16_t BUCKET_LIMITS[BUCKETS] PROGMEM;  ///< Bucket upper edges in ms
+
+    uint16_t _histogram[BUCKETS];  ///< Samples per bucket
+    uint16_t _last;                ///< Most recent latency in ms
+    uint16_t _min;                 ///< Best latency in ms
+    uint16_t _max;                 ///< Worst latency in ms
+    uint32_t _sum;                 ///< Sum of latencies in ms
+    uint16_t _count;               ///< Samples recorded
+    PageLatency _pages[PAGE_SLOTS];  ///< Per-page breakdown
+
+    /**
+     * @brief Halves every counter so totals never overflow
+     */
+    void decay();
+
+public:
+    /**
+     * @brief Constructor
+     * @details Sets singleton instance pointer for static access
+     */
+    UiLatencySensor();
+
+    /**
+     * @brief Records one input-to-display latency
+     * @param ms Latency in milliseconds
+     * @param page Title of the page that handled the input
+     */
+    static void registerLatency(uint16_t ms, const __FlashStringHelper* page);
+
+    /**
+     * @brief Gets the most recent latency
+     * @return Latency in milliseconds
+     */
+    int16_t getValue() const override { return static_cast<int16_t>(_last); }
+
+    /**
+     * @brief Gets the number of samples recorded
+     * @return Sample count (halved when it would overflow)
+     */
+    uint16_t getCount() const { return _count; }
+
+    /**
+     * @brief Gets the best latency
+     * @return Milliseconds, 0 if no samples
+     */
+    uint16_t getMin() const { return _count ? _min : 0; }
+
+    /**
+     * @brief Gets the worst latency
+     * @return Milliseconds
+     */
+    uint16_t getMax() const { return _max; }
+
+    /**
+     * @brief Gets the average latency
+     * @return Milliseconds, 0 if no samples
+     */
+    uint16_t getAverage() const { return _count ? static_cast<uint16_t>(_sum / _count) : 0; }
+
+    /**
+     * @brief Gets the 95th percentile latency
+     * @return Upper edge of the bucket holding the 95th percentile, in ms
+     */
+    uint16_t getP95() const;
+
+    /**
+     * @brief Gets the breakdown for one page slot
+     * @param slot Slot index (0 to PAGE_SLOTS - 1)
+     * @return Page summary; title is nullptr for unused slots
+     */
+    const PageLatency& getPage(uint8_t slot) const { return _pages[slot]; }
+};
+
 #endif
\ No newline at end of file
@@ -27,7 +27,6 @@
 #include "i2cmaster.h"
 #include "lcd.h"
 #include "util/delay.h"
-#include <stdio.h>
 
 // Include DebugConfig per flag DEBUG_I2C
 #ifndef DEBUG_I2C
@@ -99,6 +98,28 @@
 #define LCD_MAX_COLS             20
 #define LCD_MAX_ROWS             4
 
+// Direct 4-bit parallel mode: build with -D LCD_PARALLEL to drive the HD44780
+// from port pins instead of the PCF8574 backpack, behind the same LCD_* API.
+// A character then costs ~45 us instead of ~1.3 ms of I2C traffic.
+// RW must be tied to GND: the parallel path is write-only, so busy flag and
+// RAM reads return 0. The stock wiring leaves no six free pins, so there is
+// no default pin map: pass both groups with -D flags, e.g.
+//   -D LCD_DATA_PORT=PORTD -D LCD_DATA_DDR=DDRD -D LCD_DATA_SHIFT=4
+//   -D LCD_CTRL_PORT=PORTB -D LCD_CTRL_DDR=DDRB -D LCD_RS_BIT=0 -D LCD_EN_BIT=1
+// D4..D7 go on four adjacent bits of one port; RS, En (and the optional
+// backlight) on one port. Move the buttons/lights off those pins first.
+#ifdef LCD_PARALLEL
+#include <avr/io.h>
+#if !defined(LCD_DATA_PORT) || !defined(LCD_DATA_DDR) || !defined(LCD_DATA_SHIFT)
+#error "LCD_PARALLEL needs LCD_DATA_PORT, LCD_DATA_DDR and LCD_DATA_SHIFT"
+#endif
+#if !defined(LCD_CTRL_PORT) || !defined(LCD_CTRL_DDR) || !defined(LCD_RS_BIT) || !defined(LCD_EN_BIT)
+#error "LCD_PARALLEL needs LCD_CTRL_PORT, LCD_CTRL_DDR, LCD_RS_BIT and LCD_EN_BIT"
+#endif
+// Define LCD_BL_BIT (on LCD_CTRL_PORT) if the backlight is switched by a pin
+#define LCD_DATA_MASK   (0x0F << LCD_DATA_SHIFT)
+#endif
+
 //
 // Code was written with the following assumptions as to PCF8574 -> Parallel 4bit convertor interconnections
 // controlling a 20 by 4 LCD display. Assumes A0...A2 on PCF8574 are all pulled high. Giving address of 0x4E or 0b01001110 (0x27)
@@ -174,6 +195,7 @@ static unsigned char _displayfunction = 0;
 static unsigned char _displaycontrol = 0;
 static unsigned char _numlines = 0;
 static unsigned char _backlightval = 0;
+static unsigned long _busbytes = 0;     // Bytes clocked over I2C (address + data), or LCD bytes written in parallel mode
 
 
 // Local function declarations
@@ -181,20 +203,17 @@ static unsigned char _backlightval = 0;
 static void LCD_send(unsigned char value, unsigned char mode);
 static unsigned char LCD_receive(unsigned char RsMode);
 static void LCD_write4bits(unsigned char value);
+#ifndef LCD_PARALLEL
 static unsigned char LCD_read4bits(unsigned char RsEnMode);
 static void LCD_pulse_enable_neg(unsigned char value);
 static void LCD_pulse_enable_pos(unsigned char value);
 static void LCD_write_PCF8574(unsigned char value);
 static unsigned char LCD_read_PCF8574(void);
+#endif
 
 
-int putchr(char c, FILE *stream);
-
-FILE mystdout = FDEV_SETUP_STREAM(putchr, NULL, _FDEV_SETUP_WRITE);
-
 void LCD_init(void){
 	
-	stdout = &mystdout;
 	//_backlightval &= ~Bl; // Off at start up
 	_backlightval |= Bl; // On at start up
 	_numlines = LCD_MAX_ROWS;
@@ -203,9 +222,20 @@ void LCD_init(void){
 	_delay_us(50000);
 
 	// Set all control and data lines low. D4 - D7, En (High=1), Rw (Low = 0 or Write), Rs (Control/Instruction) (Low = 0 or Control)
+#ifdef LCD_PARALLEL
+	LCD_DATA_DDR |= LCD_DATA_MASK;
+	LCD_DATA_PORT &= ~LCD_DATA_MASK;
+	LCD_CTRL_DDR |= (1 << LCD_RS_BIT) | (1 << LCD_EN_BIT);
+	LCD_CTRL_PORT &= ~((1 << LCD_RS_BIT) | (1 << LCD_EN_BIT));
+#ifdef LCD_BL_BIT
+	LCD_CTRL_DDR |= (1 << LCD_BL_BIT);
+	LCD_CTRL_PORT |= (1 << LCD_BL_BIT);
+#endif
+#else
 	//I2C_Write_Byte_Single_Reg(LCD_PCF8574_ADDR, LCD_INIT); // Backlight off (Bit 3 = 0)
 	i2c_start_wait(LCD_PCF8574_ADDR + I2C_WRITE);
 	i2c_write(LCD_INIT);
+#endif
 	_delay_us(100);
 
 	// Sequence to put the LCD into 4 bit mode this is according to the hitachi HD44780 datasheet page 109
@@ -273,6 +303,15 @@ void LCD_write_str(const char *message)
 	LCD_data_write((unsigned char) (*message_ptr++));
 }
 
+// Writes exactly len bytes, so CGRAM character 0 can be sent as data
+void LCD_write_buf(const char *data, unsigned char len)
+{
+	const unsigned char *data_ptr = (const unsigned char *) data;
+
+	while (len--)
+	LCD_data_write(*data_ptr++);
+}
+
 
 void LCD_clear(void){
 	LCD_command_write(LCD_CLEAR_DISPLAY);// clear display, set cursor position to zero
@@ -388,12 +427,24 @@ void LCDcreateChar(unsigned char location, unsigned char charmap[]) {
 // Turn the (optional) backlight off/on
 void LCD_no_backlight(void) {
 	_backlightval &= ~Bl;
+#ifdef LCD_PARALLEL
+#ifdef LCD_BL_BIT
+	LCD_CTRL_PORT &= ~(1 << LCD_BL_BIT);
+#endif
+#else
 	LCD_write_PCF8574(LCD_read_PCF8574());  // Dummy write to LCD, only led control bit is of interest
+#endif
 }
 
 void LCD_backlight(void) {
 	_backlightval |= Bl;
+#ifdef LCD_PARALLEL
+#ifdef LCD_BL_BIT
+	LCD_CTRL_PORT |= (1 << LCD_BL_BIT);
+#endif
+#else
 	LCD_write_PCF8574(LCD_read_PCF8574());  // Dummy write to LCD, only led control bit is of interest
+#endif
 }
 
 
@@ -436,6 +487,13 @@ unsigned char LCD_read_CGRam(unsigned char address)
 	return LCD_data_read();
 }
 
+// Total bytes sent or received on the I2C bus by this driver since boot
+// (bytes written to the controller in parallel mode)
+unsigned long LCD_bus_bytes(void)
+{
+	return _busbytes;
+}
+
 /************ low level data write commands **********/
 
 // Change this routine for your I2C to 16 pin parallel interface, if your pin interconnects are different to that outlined above // TODO Adapt
@@ -449,12 +507,20 @@ static void LCD_send(unsigned char value, unsigned char RsMode) {
 
 	LCD_write4bits((highnib) | En | RsMode);
 	LCD_write4bits((lownib ) | En | RsMode);
+#ifdef LCD_PARALLEL
+	_delay_us(40);		// commands need > 37us to settle (I2C path waits per nibble)
+	_busbytes++;		// one byte per two nibbles, so the rate reads in B/s
+#endif
 }
 
 // Change this routine for your I2C to 16 pin parallel interface, if your pin interconnects are different to that outlined above // TODO Adapt
 
 // read either command or data
 static unsigned char LCD_receive(unsigned char RsMode) {
+#ifdef LCD_PARALLEL
+	(void) RsMode;
+	return 0;	// RW is tied low, the controller cannot be read
+#else
 	unsigned char highnib;
 	unsigned char lownib;
 
@@ -463,16 +529,31 @@ static unsigned char LCD_receive(unsigned char RsMode) {
 	lownib = LCD_read4bits(LCD_PCF8574_WEAK_PU | En | RsMode);
 	LCD_write_PCF8574((LCD_PCF8574_WEAK_PU & ~LCD_PCF8574_WEAK_PU) | En | RsMode); // Set P7..P4 = 1, En = 1, RnW = 0, Rs = XX
 	return (unsigned char) ((highnib & 0xF0) | ((lownib & 0xF0) >> 4));
+#endif
 }
 
 
 
 static void LCD_write4bits(unsigned char nibEnRsMode) {
+#ifdef LCD_PARALLEL
+	if (nibEnRsMode & Rs) {
+		LCD_CTRL_PORT |= (1 << LCD_RS_BIT);
+	} else {
+		LCD_CTRL_PORT &= ~(1 << LCD_RS_BIT);
+	}
+	// Only the four data bits are touched; the rest of the port keeps its state
+	LCD_DATA_PORT = (LCD_DATA_PORT & ~LCD_DATA_MASK) | (((nibEnRsMode >> 4) << LCD_DATA_SHIFT) & LCD_DATA_MASK);
+	LCD_CTRL_PORT |= (1 << LCD_EN_BIT);
+	_delay_us(1);		// enable pulse must be >450ns
+	LCD_CTRL_PORT &= ~(1 << LCD_EN_BIT);
+#else
 	LCD_write_PCF8574(nibEnRsMode & ~Rw);
 	LCD_pulse_enable_neg(nibEnRsMode & ~Rw);
+#endif
 }
 
 
+#ifndef LCD_PARALLEL
 static unsigned char LCD_read4bits(unsigned char RsEnMode) {
 	unsigned char b;
 	LCD_pulse_enable_pos(RsEnMode | Rw);
@@ -506,6 +587,7 @@ static void LCD_write_PCF8574(unsigned char value) {
     i2c_start_wait(LCD_PCF8574_ADDR + I2C_WRITE);
     i2c_write(value | _backlightval);
     i2c_stop();
+    _busbytes += 2;
 #if DEBUG_I2C
     digitalWrite(LED_BUILTIN, LOW);
 #endif
@@ -520,17 +602,10 @@ static unsigned char LCD_read_PCF8574(void) {
     i2c_start_wait(LCD_PCF8574_ADDR + I2C_READ);
     unsigned char result = i2c_readNak();
     i2c_stop();
+    _busbytes += 2;
 #if DEBUG_I2C
     digitalWrite(LED_BUILTIN, LOW);
 #endif
     return result;
 }
-
-/* putchr provides an interface to avr gcc stdio stdout to be used
-   for formatted output with printf
-*/
-int putchr(char c, FILE *stream)
-{
-	LCD_write_char(c);
- 	return 0;	
-}
+#endif // !LCD_PARALLEL
@@ -10,6 +10,7 @@ extern "C" {
 	void LCD_init(void);
 	void LCD_write_char(char message);
 	void LCD_write_str(const char *message);
+	void LCD_write_buf(const char *data, unsigned char len);
 
 	void LCD_clear(void);
 	void LCD_home(void);
@@ -39,6 +40,7 @@ extern "C" {
 	unsigned char LCD_address_counter(void);
 	unsigned char LCD_read_DDRam(unsigned char address);
 	unsigned char LCD_read_CGRam(unsigned char address);
+	unsigned long LCD_bus_bytes(void);
 	
 #ifdef	__cplusplus
 }
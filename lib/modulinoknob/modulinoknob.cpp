@@ -168,6 +168,16 @@ KnobEvent ModulinoKnob::update() {
     return event;
 }
 
+bool ModulinoKnob::read(int16_t& value, bool& pressed) {
+    uint8_t buf[3];
+    if (!readData(buf, 3)) {
+        return false;
+    }
+    value = (uint16_t)buf[0] | ((uint16_t)buf[1] << 8);
+    pressed = (buf[2] != 0);
+    return true;
+}
+
 // --- Private I2C Helpers using i2cmaster ---
 
 bool ModulinoKnob::readData(uint8_t* buf, uint8_t count) {
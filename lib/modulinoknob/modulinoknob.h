@@ -59,6 +59,13 @@ public:
      */
     KnobEvent update();
 
+    /**
+     * Legge encoder e pulsante con una sola transazione I2C, senza
+     * interpretarli: per chi gestisce da sé rotazione e gesti.
+     * @return false se il modulo non ha risposto.
+     */
+    bool read(int16_t& value, bool& pressed);
+
     /**
      * Imposta il valore corrente dell'encoder
      */
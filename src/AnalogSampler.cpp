@@ -0,0 +1,61 @@
+/**
+ * @file AnalogSampler.cpp
+ * @brief Implementation of the background ADC sampler
+ * @author Andrea Bortolotti
+ * @version 2.0
+ * @ingroup HAL
+ */
+#include "AnalogSampler.h"
+
+AnalogSampler& AnalogSampler::instance() {
+    static AnalogSampler inst;
+    return inst;
+}
+
+// cppcheck-suppress unusedFunction
+uint8_t AnalogSampler::add(uint8_t pin) {
+    if (_count == MAX_CHANNELS) return NO_SLOT;
+    claim();
+    pinMode(pin, INPUT);
+
+    uint8_t slot = _count;
+    _channels[slot] = static_cast<uint8_t>((pin >= A0 ? pin - A0 : pin) & 0x07);
+    _values[slot] = analogRead(pin);
+    _fresh |= static_cast<uint8_t>(1 << slot);
+    _count++;
+    return slot;
+}
+
+void AnalogSampler::collect() {
+    uint8_t low = ADCL;
+    uint8_t high = ADCH;
+    _values[_current] = static_cast<uint16_t>((high << 8) | low);
+    _fresh |= static_cast<uint8_t>(1 << _current);
+    _busy = false;
+}
+
+void AnalogSampler::update() {
+    if (_busy) {
+        if (bit_is_set(ADCSRA, ADSC)) return;
+        collect();
+    }
+    if (_count == 0) return;
+
+    uint8_t now = static_cast<uint8_t>(millis());
+    if (static_cast<uint8_t>(now - _lastStart) < SAMPLE_INTERVAL_MS) return;
+    _lastStart = now;
+
+    _current = (_current + 1 < _count) ? _current + 1 : 0;
+    ADMUX = static_cast<uint8_t>(_BV(REFS0) | _channels[_current]);
+    ADCSRA |= static_cast<uint8_t>(_BV(ADSC));
+    _busy = true;
+}
+
+bool AnalogSampler::take(uint8_t slot, uint16_t& value) {
+    if (slot >= _count) return false;
+    uint8_t bit = static_cast<uint8_t>(1 << slot);
+    if (!(_fresh & bit)) return false;
+    _fresh &= static_cast<uint8_t>(~bit);
+    value = _values[slot];
+    return true;
+}
@@ -0,0 +1,115 @@
+/**
+ * @file BigDigits.cpp
+ * @brief Implementation of the big numeral renderer
+ * @author Andrea Bortolotti
+ * @version 2.0
+ * @ingroup UI
+ */
+#include "BigDigits.h"
+#include "Display.h"
+
+const uint8_t GLYPH_BIG[BIG_GLYPHS][8] PROGMEM = {
+    {0x07, 0x0F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F},  // 0: left top
+    {0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00},  // 1: upper bar
+    {0x1C, 0x1E, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F},  // 2: right top
+    {0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x0F, 0x07},  // 3: left bottom
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F},  // 4: lower bar
+    {0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1E, 0x1C},  // 5: right bottom
+    {0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x1F}   // 6: upper + middle bar
+};
+
+#define BIG_BLANK 0xFE  ///< Cell left empty
+#define BIG_FULL  0xFF  ///< ROM full block
+
+/**
+ * @brief Cell layout per numeral: 3 top cells then 3 bottom cells
+ * @details Rows 0-9 are the digits, row 10 is '-', row 11 is blank.
+ */
+static const uint8_t BIG_LAYOUT[12][6] PROGMEM = {
+    {0, 1, 2,                   3, 4, 5},
+    {1, 2, BIG_BLANK,           4, BIG_FULL, 4},
+    {6, 6, 2,                   3, 4, 4},
+    {6, 6, 2,                   4, 4, 5},
+    {3, 4, BIG_FULL,            BIG_BLANK, BIG_BLANK, BIG_FULL},
+    {BIG_FULL, 6, 6,            4, 4, 5},
+    {0, 6, 6,                   3, 4, 5},
+    {1, 1, 2,                   BIG_BLANK, BIG_BLANK, BIG_FULL},
+    {0, 6, 2,                   3, 4, 5},
+    {0, 6, 2,                   BIG_BLANK, BIG_BLANK, BIG_FULL},
+    {4, 4, 4,                   BIG_BLANK, BIG_BLANK, BIG_BLANK},
+    {BIG_BLANK, BIG_BLANK, BIG_BLANK, BIG_BLANK, BIG_BLANK, BIG_BLANK}
+};
+
+BigDigitRenderer::BigDigitRenderer() {
+    for (uint8_t i = 0; i < BIG_GLYPHS; i++) {
+        _slots[i] = CGRAMManager::NO_SLOT;
+    }
+    acquire();
+}
+
+BigDigitRenderer::~BigDigitRenderer() {
+    release();
+}
+
+bool BigDigitRenderer::acquire() {
+    for (uint8_t i = 0; i < BIG_GLYPHS; i++) {
+        if (_slots[i] == CGRAMManager::NO_SLOT) {
+            _slots[i] = CGRAMManager::instance().acquire(GLYPH_BIG[i]);
+        }
+    }
+    if (isReady()) return true;
+    release();
+    return false;
+}
+
+void BigDigitRenderer::release() {
+    for (uint8_t i = 0; i < BIG_GLYPHS; i++) {
+        CGRAMManager::instance().release(_slots[i]);
+        _slots[i] = CGRAMManager::NO_SLOT;
+    }
+}
+
+bool BigDigitRenderer::isReady() const {
+    for (uint8_t i = 0; i < BIG_GLYPHS; i++) {
+        if (_slots[i] == CGRAMManager::NO_SLOT) return false;
+    }
+    return true;
+}
+
+void BigDigitRenderer::compose(char* top, char* bottom, char c) const {
+    uint8_t index;
+    if (c >= '0' && c <= '9') {
+        index = c - '0';
+    } else if (c == '-') {
+        index = 10;
+    } else {
+        index = 11;
+    }
+
+    for (uint8_t i = 0; i < 2 * WIDTH; i++) {
+        uint8_t cell = pgm_read_byte(&BIG_LAYOUT[index][i]);
+        char out;
+        if (cell == BIG_BLANK) {
+            out = ' ';
+        } else if (cell == BIG_FULL) {
+            out = static_cast<char>(0xFF);
+        } else {
+            out = static_cast<char>(_slots[cell]);
+        }
+        if (i < WIDTH) {
+            top[i] = out;
+        } else {
+            bottom[i - WIDTH] = out;
+        }
+    }
+}
+
+void BigDigitRenderer::draw(uint8_t col, uint8_t row, char c) const {
+    char top[WIDTH];
+    char bottom[WIDTH];
+    compose(top, bottom, c);
+    IDisplay::instance().setCursor(col, row);
+    IDisplay::instance().write(top, WIDTH);
+    IDisplay::instance().setCursor(col, row + 1);
+    IDisplay::instance().write(bottom, WIDTH);
+}
@@ -0,0 +1,80 @@
+/**
+ * @file CustomChars.cpp
+ * @brief Implementation of the CGRAM slot manager
+ * @author Andrea Bortolotti
+ * @version 2.0
+ * @ingroup UI
+ */
+#include "CustomChars.h"
+#include "Display.h"
+
+const uint8_t GLYPH_BAR[4][8] PROGMEM = {
+    {0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C},
+    {0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E}
+};
+
+CGRAMManager::CGRAMManager() : _clock(0) {
+    invalidate();
+}
+
+CGRAMManager& CGRAMManager::instance() {
+    static CGRAMManager inst;
+    return inst;
+}
+
+uint16_t CGRAMManager::tick() {
+    if (++_clock == 0) {
+        for (uint8_t i = 0; i < SLOT_COUNT; i++) _slots[i].lastUse = 0;
+    }
+    return _clock;
+}
+
+uint8_t CGRAMManager::acquire(const uint8_t* glyph) {
+    uint8_t victim = NO_SLOT;
+    uint16_t victimAge = 0;
+
+    for (uint8_t i = 0; i < SLOT_COUNT; i++) {
+        Slot& s = _slots[i];
+        if (s.glyph == glyph) {
+            s.refCount++;
+            s.lastUse = tick();
+            return i;
+        }
+        if (s.refCount == 0) {
+            // Never-used slots win over any resident glyph
+            uint16_t age = s.glyph ? static_cast<uint16_t>(_clock - s.lastUse) : 0xFFFF;
+            if (victim == NO_SLOT || age > victimAge) {
+                victim = i;
+                victimAge = age;
+            }
+        }
+    }
+
+    if (victim == NO_SLOT) return NO_SLOT;
+
+    uint8_t buffer[8];
+    memcpy_P(buffer, glyph, 8);
+    IDisplay::instance().defineGlyph(victim, buffer);
+
+    Slot& s = _slots[victim];
+    s.glyph = glyph;
+    s.refCount = 1;
+    s.lastUse = tick();
+    return victim;
+}
+
+void CGRAMManager::release(uint8_t slot) {
+    if (slot < SLOT_COUNT && _slots[slot].refCount > 0) {
+        _slots[slot].refCount--;
+    }
+}
+
+void CGRAMManager::invalidate() {
+    for (uint8_t i = 0; i < SLOT_COUNT; i++) {
+        _slots[i].glyph = nullptr;
+        _slots[i].refCount = 0;
+        _slots[i].lastUse = 0;
+    }
+}
@@ -36,7 +36,7 @@ const RGBColor PRESET_COLORS[] PROGMEM = {
     {  0, 100, 180}   ///< OCEAN
 };
 
-SensorStats::SensorStats() {
+SensorStats::SensorStats() : _last(0) {
     reset();
 }
 
@@ -50,6 +50,7 @@ void SensorStats::addSample(int16_t value) {
     if (value > _max) _max = value;
     _sum += value;
     _count++;
+    _last = value;
 }
 
 // cppcheck-suppress unusedFunction
@@ -406,6 +407,43 @@ void LoopTimeSensorDevice::update() {
     }
 }
 
+LcdTrafficSensorDevice::LcdTrafficSensorDevice(const __FlashStringHelper* name)
+    : IDevice(name, DeviceType::SensorLcdTraffic), _rate(0), _lastCount(0), _lastRead(0) {
+    DeviceRegistry::instance().registerDevice(this);
+    _lastCount = _trafficSensor.getValue();
+    _lastRead = millis();
+}
+
+void LcdTrafficSensorDevice::update() {
+    unsigned long now = millis();
+    if (now - _lastRead >= UPDATE_INTERVAL_MS) {
+        uint32_t count = _trafficSensor.getValue();
+        uint32_t perSecond = ((count - _lastCount) * 1000UL) / (now - _lastRead);
+        _lastRead = now;
+        _lastCount = count;
+        _rate = static_cast<int16_t>(perSecond > 32767UL ? 32767UL : perSecond);
+        _stats.addSample(_rate);
+        EventSystem::instance().emit(EventType::SensorUpdated, this, _rate);
+    }
+}
+
+UiLatencySensorDevice::UiLatencySensorDevice(const __FlashStringHelper* name)
+    : IDevice(name, DeviceType::SensorUiLatency), _lastCount(0), _lastRead(0) {
+    DeviceRegistry::instance().registerDevice(this);
+}
+
+void UiLatencySensorDevice::update() {
+    unsigned long now = millis();
+    if (now - _lastRead >= UPDATE_INTERVAL_MS) {
+        _lastRead = now;
+        uint16_t count = _latencySensor.getCount();
+        if (count != _lastCount) {
+            _lastCount = count;
+            EventSystem::instance().emit(EventType::SensorUpdated, this, _latencySensor.getValue());
+        }
+    }
+}
+
 OutsideLight::OutsideLight(const __FlashStringHelper* name, uint8_t pin,
                            PhotoresistorSensor* photo, PIRSensorDevice* motion)
     : SimpleLight(name, pin), _mode(OutsideMode::OFF), _photo(photo), _motion(motion) {
@@ -526,3 +564,13 @@ void DeviceFactory::createVoltageSensor(const __FlashStringHelper* name) {
 void DeviceFactory::createLoopTimeSensor(const __FlashStringHelper* name) {
     new LoopTimeSensorDevice(name);
 }
+
+// cppcheck-suppress unusedFunction
+void DeviceFactory::createLcdTrafficSensor(const __FlashStringHelper* name) {
+    new LcdTrafficSensorDevice(name);
+}
+
+// cppcheck-suppress unusedFunction
+void DeviceFactory::createUiLatencySensor(const __FlashStringHelper* name) {
+    new UiLatencySensorDevice(name);
+}
@@ -0,0 +1,282 @@
+/**
+ * @file Display.cpp
+ * @brief Implementation of the HD44780 and SSD1306 display backends
+ * @author Andrea Bortolotti
+ * @version 2.0
+ * @ingroup UI
+ */
+#include "Display.h"
+#include <avr/pgmspace.h>
+#include "i2cmaster.h"
+extern "C" {
+    #include "lcd.h"
+}
+
+// cppcheck-suppress unusedFunction
+IDisplay& IDisplay::instance() {
+#ifdef DISPLAY_SSD1306
+    static SSD1306Display inst;
+#else
+    static HD44780Display inst;
+#endif
+    return inst;
+}
+
+// ==================== HD44780 ====================
+
+void HD44780Display::begin() {
+    LCD_init();
+    LCD_backlight();
+}
+
+void HD44780Display::clear() {
+    LCD_clear();
+}
+
+void HD44780Display::setCursor(uint8_t col, uint8_t row) {
+    LCD_set_cursor(col, row);
+}
+
+void HD44780Display::write(const char* data, uint8_t len) {
+    LCD_write_buf(data, len);
+}
+
+void HD44780Display::writeChar(char c) {
+    LCD_write_char(c);
+}
+
+void HD44780Display::defineGlyph(uint8_t slot, const uint8_t* bitmap) {
+    LCDcreateChar(slot, const_cast<uint8_t*>(bitmap));
+}
+
+void HD44780Display::setPower(bool on) {
+    if (on) {
+        LCD_backlight();
+    } else {
+        LCD_no_backlight();
+    }
+}
+
+uint32_t HD44780Display::busBytes() const {
+    return LCD_bus_bytes();
+}
+
+// ==================== SSD1306 ====================
+
+/**
+ * @brief SSD1306 power-up sequence for a 128x64 panel with charge pump
+ */
+static const uint8_t SSD1306_INIT[] PROGMEM = {
+    0xAE,        // display off
+    0xD5, 0x80,  // clock divide
+    0xA8, 0x3F,  // multiplex 64
+    0xD3, 0x00,  // no display offset
+    0x40,        // start line 0
+    0x8D, 0x14,  // charge pump on
+    0x20, 0x00,  // horizontal addressing, windows wrap by column
+    0xA1,        // segment remap
+    0xC8,        // COM scan descending
+    0xDA, 0x12,  // COM pins
+    0x81, 0xCF,  // contrast
+    0xD9, 0xF1,  // pre-charge
+    0xDB, 0x40,  // VCOMH
+    0xA4,        // follow RAM
+    0xA6,        // normal (not inverted)
+    0xAF         // display on
+};
+
+/**
+ * @brief 5x7 font for 0x20-0x7F, one byte per pixel column, LSB = top
+ * @details 0x7E and 0x7F are arrows as in the HD44780 ROM.
+ */
+static const uint8_t FONT_5X7[96][5] PROGMEM = {
+    {0x00, 0x00, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x5F, 0x00, 0x00}, {0x00, 0x07, 0x00, 0x07, 0x00}, {0x14, 0x7F, 0x14, 0x7F, 0x14},
+    {0x24, 0x2A, 0x7F, 0x2A, 0x12}, {0x23, 0x13, 0x08, 0x64, 0x62}, {0x36, 0x49, 0x55, 0x22, 0x50}, {0x00, 0x05, 0x03, 0x00, 0x00},
+    {0x00, 0x1C, 0x22, 0x41, 0x00}, {0x00, 0x41, 0x22, 0x1C, 0x00}, {0x08, 0x2A, 0x1C, 0x2A, 0x08}, {0x08, 0x08, 0x3E, 0x08, 0x08},
+    {0x00, 0x50, 0x30, 0x00, 0x00}, {0x08, 0x08, 0x08, 0x08, 0x08}, {0x00, 0x60, 0x60, 0x00, 0x00}, {0x20, 0x10, 0x08, 0x04, 0x02},
+    {0x3E, 0x51, 0x49, 0x45, 0x3E}, {0x00, 0x42, 0x7F, 0x40, 0x00}, {0x42, 0x61, 0x51, 0x49, 0x46}, {0x21, 0x41, 0x45, 0x4B, 0x31},
+    {0x18, 0x14, 0x12, 0x7F, 0x10}, {0x27, 0x45, 0x45, 0x45, 0x39}, {0x3C, 0x4A, 0x49, 0x49, 0x30}, {0x01, 0x71, 0x09, 0x05, 0x03},
+    {0x36, 0x49, 0x49, 0x49, 0x36}, {0x06, 0x49, 0x49, 0x29, 0x1E}, {0x00, 0x36, 0x36, 0x00, 0x00}, {0x00, 0x56, 0x36, 0x00, 0x00},
+    {0x08, 0x14, 0x22, 0x41, 0x00}, {0x14, 0x14, 0x14, 0x14, 0x14}, {0x00, 0x41, 0x22, 0x14, 0x08}, {0x02, 0x01, 0x51, 0x09, 0x06},
+    {0x32, 0x49, 0x79, 0x41, 0x3E}, {0x7E, 0x11, 0x11, 0x11, 0x7E}, {0x7F, 0x49, 0x49, 0x49, 0x36}, {0x3E, 0x41, 0x41, 0x41, 0x22},
+    {0x7F, 0x41, 0x41, 0x22, 0x1C}, {0x7F, 0x49, 0x49, 0x49, 0x41}, {0x7F, 0x09, 0x09, 0x01, 0x01}, {0x3E, 0x41, 0x41, 0x51, 0x32},
+    {0x7F, 0x08, 0x08, 0x08, 0x7F}, {0x00, 0x41, 0x7F, 0x41, 0x00}, {0x20, 0x40, 0x41, 0x3F, 0x01}, {0x7F, 0x08, 0x14, 0x22, 0x41},
+    {0x7F, 0x40, 0x40, 0x40, 0x40}, {0x7F, 0x02, 0x04, 0x02, 0x7F}, {0x7F, 0x04, 0x08, 0x10, 0x7F}, {0x3E, 0x41, 0x41, 0x41, 0x3E},
+    {0x7F, 0x09, 0x09, 0x09, 0x06}, {0x3E, 0x41, 0x51, 0x21, 0x5E}, {0x7F, 0x09, 0x19, 0x29, 0x46}, {0x46, 0x49, 0x49, 0x49, 0x31},
+    {0x01, 0x01, 0x7F, 0x01, 0x01}, {0x3F, 0x40, 0x40, 0x40, 0x3F}, {0x1F, 0x20, 0x40, 0x20, 0x1F}, {0x7F, 0x20, 0x18, 0x20, 0x7F},
+    {0x63, 0x14, 0x08, 0x14, 0x63}, {0x03, 0x04, 0x78, 0x04, 0x03}, {0x61, 0x51, 0x49, 0x45, 0x43}, {0x00, 0x7F, 0x41, 0x41, 0x00},
+    {0x02, 0x04, 0x08, 0x10, 0x20}, {0x00, 0x41, 0x41, 0x7F, 0x00}, {0x04, 0x02, 0x01, 0x02, 0x04}, {0x40, 0x40, 0x40, 0x40, 0x40},
+    {0x00, 0x01, 0x02, 0x04, 0x00}, {0x20, 0x54, 0x54, 0x54, 0x78}, {0x7F, 0x48, 0x44, 0x44, 0x38}, {0x38, 0x44, 0x44, 0x44, 0x20},
+    {0x38, 0x44, 0x44, 0x48, 0x7F}, {0x38, 0x54, 0x54, 0x54, 0x18}, {0x08, 0x7E, 0x09, 0x01, 0x02}, {0x08, 0x14, 0x54, 0x54, 0x3C},
+    {0x7F, 0x08, 0x04, 0x04, 0x78}, {0x00, 0x44, 0x7D, 0x40, 0x00}, {0x20, 0x40, 0x44, 0x3D, 0x00}, {0x00, 0x7F, 0x10, 0x28, 0x44},
+    {0x00, 0x41, 0x7F, 0x40, 0x00}, {0x7C, 0x04, 0x18, 0x04, 0x78}, {0x7C, 0x08, 0x04, 0x04, 0x78}, {0x38, 0x44, 0x44, 0x44, 0x38},
+    {0x7C, 0x14, 0x14, 0x14, 0x08}, {0x08, 0x14, 0x14, 0x18, 0x7C}, {0x7C, 0x08, 0x04, 0x04, 0x08}, {0x48, 0x54, 0x54, 0x54, 0x20},
+    {0x04, 0x3F, 0x44, 0x40, 0x20}, {0x3C, 0x40, 0x40, 0x20, 0x7C}, {0x1C, 0x20, 0x40, 0x20, 0x1C}, {0x3C, 0x40, 0x30, 0x40, 0x3C},
+    {0x44, 0x28, 0x10, 0x28, 0x44}, {0x0C, 0x50, 0x50, 0x50, 0x3C}, {0x44, 0x64, 0x54, 0x4C, 0x44}, {0x00, 0x08, 0x36, 0x41, 0x00},
+    {0x00, 0x00, 0x7F, 0x00, 0x00}, {0x00, 0x41, 0x36, 0x08, 0x00}, {0x08, 0x08, 0x2A, 0x1C, 0x08}, {0x08, 0x1C, 0x2A, 0x08, 0x08}
+};
+
+static const uint8_t FONT_DEGREE[5] PROGMEM = {0x00, 0x06, 0x09, 0x09, 0x06};  ///< 0xDF
+static const uint8_t FONT_DOT[5] PROGMEM = {0x00, 0x18, 0x18, 0x00, 0x00};     ///< 0xA5
+
+/**
+ * @brief Doubles each bit of a nibble (vertical 2x stretch)
+ */
+static const uint8_t STRETCH[16] PROGMEM = {
+    0x00, 0x03, 0x0C, 0x0F, 0x30, 0x33, 0x3C, 0x3F,
+    0xC0, 0xC3, 0xCC, 0xCF, 0xF0, 0xF3, 0xFC, 0xFF
+};
+
+SSD1306Display::SSD1306Display() : _col(0), _row(0), _on(false), _busBytes(0) {
+    memset(_text, ' ', sizeof(_text));
+    memset(_glyphs, 0, sizeof(_glyphs));
+    memset(_dirty, 0, sizeof(_dirty));
+}
+
+void SSD1306Display::command(const uint8_t* cmds, uint8_t len) {
+    i2c_start_wait(ADDRESS + I2C_WRITE);
+    i2c_write(0x00);  // control byte: command stream
+    for (uint8_t i = 0; i < len; i++) {
+        i2c_write(cmds[i]);
+    }
+    i2c_stop();
+    _busBytes += 2 + len;
+}
+
+void SSD1306Display::begin() {
+    uint8_t init[sizeof(SSD1306_INIT)];
+    memcpy_P(init, SSD1306_INIT, sizeof(init));
+    command(init, sizeof(init));
+    _on = true;
+
+    // Blank the whole GDDRAM, including the side margins never written later
+    const uint8_t window[] = {0x21, 0, 127, 0x22, 0, 7};
+    command(window, sizeof(window));
+    i2c_start_wait(ADDRESS + I2C_WRITE);
+    i2c_write(0x40);  // control byte: data stream
+    for (uint16_t i = 0; i < 1024; i++) {
+        i2c_write(0x00);
+    }
+    i2c_stop();
+    _busBytes += 2 + 1024;
+
+    memset(_text, ' ', sizeof(_text));
+    memset(_dirty, 0, sizeof(_dirty));
+    _col = 0;
+    _row = 0;
+}
+
+void SSD1306Display::clear() {
+    memset(_text, ' ', sizeof(_text));
+    for (uint8_t r = 0; r < ROWS; r++) {
+        _dirty[r] = (1UL << COLS) - 1;
+    }
+    _col = 0;
+    _row = 0;
+}
+
+void SSD1306Display::setCursor(uint8_t col, uint8_t row) {
+    _col = col;
+    _row = row < ROWS ? row : ROWS - 1;
+}
+
+void SSD1306Display::write(const char* data, uint8_t len) {
+    while (len--) {
+        writeChar(*data++);
+    }
+}
+
+void SSD1306Display::writeChar(char c) {
+    if (_col >= COLS) return;
+    if (_text[_row][_col] != c) {
+        _text[_row][_col] = c;
+        _dirty[_row] |= 1UL << _col;
+    }
+    _col++;
+}
+
+void SSD1306Display::defineGlyph(uint8_t slot, const uint8_t* bitmap) {
+    slot &= 0x07;
+    memcpy(_glyphs[slot], bitmap, 8);
+
+    // The HD44780 repaints glyph cells instantly; mirror that
+    for (uint8_t r = 0; r < ROWS; r++) {
+        for (uint8_t c = 0; c < COLS; c++) {
+            if (static_cast<uint8_t>(_text[r][c]) == slot) {
+                _dirty[r] |= 1UL << c;
+            }
+        }
+    }
+}
+
+void SSD1306Display::setPower(bool on) {
+    const uint8_t cmd = on ? 0xAF : 0xAE;
+    command(&cmd, 1);
+    _on = on;
+}
+
+uint8_t SSD1306Display::columnBits(char c, uint8_t x) const {
+    if (x >= 5) return 0x00;
+
+    uint8_t code = static_cast<uint8_t>(c);
+    if (code < 8) {
+        uint8_t bits = 0;
+        for (uint8_t y = 0; y < 8; y++) {
+            if (_glyphs[code][y] & (0x10 >> x)) bits |= 1 << y;
+        }
+        return bits;
+    }
+    if (code >= 0x20 && code < 0x80) return pgm_read_byte(&FONT_5X7[code - 0x20][x]);
+    if (code == 0xFF) return 0xFF;
+    if (code == 0xDF) return pgm_read_byte(&FONT_DEGREE[x]);
+    if (code == 0xA5) return pgm_read_byte(&FONT_DOT[x]);
+    return 0x00;
+}
+
+void SSD1306Display::sendRun(uint8_t row, uint8_t half, uint8_t first, uint8_t last) {
+    uint8_t page = row * 2 + half;
+    const uint8_t window[] = {
+        0x21, static_cast<uint8_t>(X_OFFSET + first * CELL_WIDTH),
+              static_cast<uint8_t>(X_OFFSET + last * CELL_WIDTH + CELL_WIDTH - 1),
+        0x22, page, page
+    };
+    command(window, sizeof(window));
+
+    i2c_start_wait(ADDRESS + I2C_WRITE);
+    i2c_write(0x40);
+    for (uint8_t c = first; c <= last; c++) {
+        for (uint8_t x = 0; x < CELL_WIDTH; x++) {
+            uint8_t bits = columnBits(_text[row][c], x);
+            i2c_write(pgm_read_byte(&STRETCH[half ? bits >> 4 : bits & 0x0F]));
+        }
+    }
+    i2c_stop();
+    _busBytes += 2 + (last - first + 1) * CELL_WIDTH;
+}
+
+void SSD1306Display::flush() {
+    if (!_on) return;
+
+    for (uint8_t r = 0; r < ROWS; r++) {
+        uint32_t mask = _dirty[r];
+        if (!mask) continue;
+
+        uint8_t c = 0;
+        while (c < COLS) {
+            if (!(mask & (1UL << c))) {
+                c++;
+                continue;
+            }
+            uint8_t end = c;
+            while (end + 1 < COLS && (mask & (1UL << (end + 1)))) end++;
+            sendRun(r, 0, c, end);
+            sendRun(r, 1, c, end);
+            c = end + 1;
+        }
+        _dirty[r] = 0;
+    }
+}
+
+uint32_t SSD1306Display::busBytes() const {
+    return _busBytes;
+}
@@ -7,28 +7,81 @@
  */
 
 #include "FlexibleMenu.h"
+#include "MemoryMonitor.h"
+#include <new.h>
 
 extern NightModeScene nightMode;
 extern PartyScene partyMode;
 extern AlarmScene alarmMode;
 
 /**
- * @brief Prints a RAM string to the LCD
- * @param str Null-terminated string in RAM
+ * @brief Column where ON/OFF style state fields start
  */
-void MenuItem::printLabel(const char* str) {
-    LCD_write_str(str);
+static constexpr uint8_t STATE_COL = 15;
+
+/**
+ * @brief Writes the selection marker into the first two cells of a row
+ * @param line Row buffer
+ * @param selected True to draw the "> " cursor
+ */
+void MenuItem::putCursor(char* line, bool selected) {
+    line[0] = selected ? '>' : ' ';
+    line[1] = ' ';
+}
+
+/**
+ * @brief Sends a composed row buffer to the LCD in one write
+ * @param row LCD row (0-3)
+ * @param line Row buffer
+ * @param len Number of cells to write from column 0
+ */
+void MenuItem::writeRow(uint8_t row, const char* line, uint8_t len) {
+    writeCells(0, row, line, len);
+}
+
+/**
+ * @brief Sends a run of cells to the LCD in one write
+ * @param col First column
+ * @param row LCD row (0-3)
+ * @param cells Cell buffer
+ * @param len Number of cells
+ */
+void MenuItem::writeCells(uint8_t col, uint8_t row, const char* cells, uint8_t len) {
+    IDisplay::instance().setCursor(col, row);
+    IDisplay::instance().write(cells, len);
+}
+
+/**
+ * @brief Formats a cursor, a left-aligned label and a state field into a row
+ * @param line Row buffer of MENU_ITEM_COLS cells
+ * @param selected True if item is selected
+ * @param label RAM label, used when f_label is nullptr
+ * @param f_label Flash label
+ * @param state Flash state text for cells 15-18 (nullptr for blank)
+ */
+static void formatStateRow(char* line, bool selected, const char* label,
+                           const __FlashStringHelper* f_label, const __FlashStringHelper* state) {
+    line[0] = selected ? '>' : ' ';
+    line[1] = ' ';
+    if (f_label) {
+        TextFormat::putLabel(line + 2, STATE_COL - 3, f_label);
+    } else {
+        TextFormat::putLabel(line + 2, STATE_COL - 3, label);
+    }
+    line[STATE_COL - 1] = ' ';
+    TextFormat::putLabel(line + STATE_COL, MENU_ITEM_COLS - STATE_COL, state);
 }
 
 /**
- * @brief Prints a Flash string to the LCD
- * @param f_str Flash string pointer
+ * @brief Rewrites only the state field (cells 15-18) of a row
+ * @param row LCD row
+ * @param state Flash state text (nullptr for blank)
  */
-void MenuItem::printLabel(const __FlashStringHelper* f_str) {
-    char buf[21];
-    strncpy_P(buf, reinterpret_cast<const char*>(f_str), 20);
-    buf[20] = 0;
-    LCD_write_str(buf);
+static void writeStateField(uint8_t row, const __FlashStringHelper* state) {
+    char cells[MENU_ITEM_COLS - STATE_COL];
+    TextFormat::putLabel(cells, sizeof(cells), state);
+    IDisplay::instance().setCursor(STATE_COL, row);
+    IDisplay::instance().write(cells, sizeof(cells));
 }
 
 /**
@@ -38,17 +91,13 @@ void MenuItem::printLabel(const __FlashStringHelper* f_str) {
  */
 MenuPage::MenuPage(const __FlashStringHelper* title, MenuPage* parent)
     : _title(title), _parent(parent), _selected_index(0), _scroll_offset(0), 
-      _needs_redraw(true) {
-    EventSystem::instance().addListener(this, EventType::DeviceStateChanged);
-    EventSystem::instance().addListener(this, EventType::DeviceValueChanged);
-    EventSystem::instance().addListener(this, EventType::SensorUpdated);
-}
+      _needs_redraw(true), _dirty_rows(0), _origin(nullptr), _originContext(nullptr),
+      _footprint(0) {}
 
 /**
- * @brief Destructor - cleans up event listeners and child items
+ * @brief Destructor - frees child items
  */
 MenuPage::~MenuPage() {
-    EventSystem::instance().removeListener(this);
     for (size_t i = 0; i < _items.size(); i++) {
         delete _items[i];
     }
@@ -102,9 +151,10 @@ size_t MenuPage::getSelectedIndex() const {
  * @param selected True if this item is currently selected
  */
 void MenuPage::draw(uint8_t row, bool selected) {
-    LCD_set_cursor(0, row);
-    LCD_write_str(selected ? "> " : "  ");
-    printLabel(_title);
+    char line[MENU_ITEM_COLS];
+    putCursor(line, selected);
+    TextFormat::putLabel(line + 2, MENU_ITEM_COLS - 2, _title);
+    writeRow(row, line, MENU_ITEM_COLS);
 }
 
 /**
@@ -113,16 +163,24 @@ void MenuPage::draw(uint8_t row, bool selected) {
  * @return True if event was handled
  */
 bool MenuPage::handleInput(InputEvent event) {
-    size_t oldIndex = _selected_index;
-
-    if (_selected_index < _items.size()) {
-        bool handled = _items[_selected_index]->handleInput(event);
-        if (handled) {
-            _needs_redraw = true;
-            return true;
-        }
+    MenuItem* item = inputItem();
+    if (item && item->handleInput(event)) {
+        markDirty(_selected_index);
+        return true;
     }
 
+    return moveCursor(event);
+}
+
+/**
+ * @brief Moves the selection and scrolls the visible window
+ * @param event Input event (only UP and DOWN are used)
+ * @return True if event was UP or DOWN
+ */
+bool MenuPage::moveCursor(InputEvent event) {
+    size_t oldIndex = _selected_index;
+    size_t count = getItemsCount();
+
     if (event == InputEvent::UP) {
         if (_selected_index > 0) { 
             _selected_index--; 
@@ -137,7 +195,7 @@ bool MenuPage::handleInput(InputEvent event) {
         }
         return true;
     } else if (event == InputEvent::DOWN) {
-        if (_selected_index < static_cast<size_t>(_items.size() - 1)) {
+        if (_selected_index + 1 < count) {
             _selected_index++; 
             
             if (_selected_index >= _scroll_offset + 3) {
@@ -155,24 +213,151 @@ bool MenuPage::handleInput(InputEvent event) {
 }
 
 /**
- * @brief Handles device events for automatic page updates
+ * @brief Activates the selected item on ENTER
+ * @return New page for submenus, nullptr otherwise
+ * @details Plain items handle ENTER themselves (actions may navigate back,
+ * which deletes this page, so nothing is touched after the call).
+ */
+MenuPage* MenuPage::handleEnter() {
+    MenuItem* item = inputItem();
+    if (!item) return nullptr;
+
+    if (item->getType() == MenuItemType::SUBMENU) {
+        return static_cast<SubMenuItem*>(item)->createPage();
+    }
+    item->handleInput(InputEvent::ENTER);
+    return nullptr;
+}
+
+/**
+ * @brief Checks if the page may be parked in PageCache
+ * @return False if any item pins CGRAM glyphs
+ */
+bool MenuPage::isCacheable() const {
+    for (size_t i = 0; i < _items.size(); i++) {
+        if (_items[i]->holdsGlyphs()) return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Builds ahead the submenu under the cursor, if any
+ */
+void MenuPage::prefetchSelected() {
+    MenuItem* item = itemAt(_selected_index);
+    if (item && item->getType() == MenuItemType::SUBMENU) {
+        static_cast<SubMenuItem*>(item)->prefetchPage();
+    }
+}
+
+/**
+ * @brief Gets an owned item by index
+ * @param index Item index
+ * @return Item, or nullptr if out of range
+ */
+MenuItem* MenuPage::itemAt(size_t index) {
+    return index < _items.size() ? _items[index] : nullptr;
+}
+
+/**
+ * @brief Gets the selected item for handling input
+ * @return Item, or nullptr
+ */
+MenuItem* MenuPage::inputItem() {
+    return itemAt(_selected_index);
+}
+
+/**
+ * @brief Draws one item on an LCD row
+ * @param index Item index
+ * @param row LCD row
+ * @param selected True if item is selected
+ */
+void MenuPage::drawRow(size_t index, uint8_t row, bool selected) {
+    MenuItem* item = itemAt(index);
+    if (item) item->draw(row, selected);
+}
+
+/**
+ * @brief Gets the row height of an item
+ * @param index Item index
+ * @return Number of LCD rows
+ */
+uint8_t MenuPage::getRowHeight(size_t index) const {
+    return _items[index]->getHeight();
+}
+
+/**
+ * @brief Gets the label field of an item
+ * @param index Item index
+ * @param col Receives the first column of the label field
+ * @param width Receives the field width in cells
+ * @return Flash label, or nullptr
+ */
+const __FlashStringHelper* MenuPage::getRowLabel(size_t index, uint8_t& col, uint8_t& width) {
+    MenuItem* item = itemAt(index);
+    return item ? item->getLabel(col, width) : nullptr;
+}
+
+/**
+ * @brief Marks visible items related to the event source for a value redraw
  * @param type Event type received
  * @param device Device that triggered the event
  * @param value Event-specific value
+ * @details Only the rows on screen are checked; scrolled-out items are
+ * redrawn in full when they come back into view.
  */
 void MenuPage::handleEvent(EventType type, IDevice* device, int value) {
     static_cast<void>(type);
     static_cast<void>(value);
     
-    const MenuPage* currentPage = NavigationManager::instance().getCurrentPage();
-    if (currentPage != this) return;
-    
-    for (size_t i = 0; i < _items.size(); i++) {
-        if (_items[i]->relatesTo(device)) {
-            _needs_redraw = true;
-            return;
+    size_t count = getItemsCount();
+    uint8_t row = 1;
+    for (size_t i = _scroll_offset; i < count && row < LCD_ROWS; i++) {
+        MenuItem* item = itemAt(i);
+        if (item && item->relatesTo(device)) {
+            _dirty_rows |= 1 << row;
+        }
+        row += getRowHeight(i);
+    }
+}
+
+/**
+ * @brief Marks an item for a value-only redraw
+ * @param index Item index (ignored when scrolled out of view)
+ */
+void MenuPage::markDirty(size_t index) {
+    if (index < _scroll_offset) return;
+
+    uint8_t row = 1;
+    for (size_t i = _scroll_offset; i < index && row < LCD_ROWS; i++) {
+        row += getRowHeight(i);
+    }
+    if (row < LCD_ROWS) _dirty_rows |= 1 << row;
+}
+
+/**
+ * @brief Calls drawValue() on every visible item whose row is dirty
+ * @param hidden Covered LCD rows; items spanning one of them keep their dirty bit
+ */
+void MenuPage::renderDirty(uint8_t hidden) {
+    size_t count = getItemsCount();
+    uint8_t held = 0;
+    uint8_t row = 1;
+    for (size_t i = _scroll_offset; i < count && row < LCD_ROWS; i++) {
+        uint8_t height = getRowHeight(i);
+        if (_dirty_rows & (1 << row)) {
+            uint8_t span = static_cast<uint8_t>(((1 << height) - 1) << row);
+            MenuItem* item = itemAt(i);
+            if (span & hidden) {
+                held |= 1 << row;
+            } else if (item) {
+                item->drawValue(row, i == _selected_index);
+            }
         }
+        row += height;
     }
+    _dirty_rows = held;
 }
 
 /**
@@ -184,10 +369,40 @@ bool MenuPage::needsRedraw() const {
 }
 
 /**
- * @brief Clears the redraw flag after rendering
+ * @brief Checks if some visible items need a value-only redraw
+ * @return True if any row is dirty
+ */
+bool MenuPage::hasDirtyRows() const {
+    return _dirty_rows != 0;
+}
+
+/**
+ * @brief Clears the redraw flag and dirty rows after a full render
  */
 void MenuPage::clearRedraw() { 
     _needs_redraw = false; 
+    _dirty_rows = 0;
+}
+
+/**
+ * @brief Gets the heap bytes of the item array and the items in it
+ * @return Bytes including one allocator header per block
+ */
+uint16_t MenuPage::itemsFootprint() const {
+    if (_items.capacity() == 0) return 0;
+    uint16_t bytes = _items.capacity() * sizeof(MenuItem*) + HEAP_HEADER;
+    for (uint8_t i = 0; i < _items.size(); i++) {
+        if (_items[i]) bytes += _items[i]->footprint() + HEAP_HEADER;
+    }
+    return bytes;
+}
+
+/**
+ * @brief Gets the heap bytes held by the page
+ * @return Page object plus item array and items, without allocator headers
+ */
+uint16_t MenuPage::footprint() const {
+    return sizeof(*this) + itemsFootprint();
 }
 
 /**
@@ -197,10 +412,231 @@ void MenuPage::forceRedraw() {
     _needs_redraw = true; 
 }
 
+/**
+ * @brief Renders full page with title, items, and scroll indicators
+ * @details Every row is rewritten at full width, so no clear() (and the
+ * HD44780's 30 ms busy wait) is needed and the screen never flashes blank.
+ */
+void MenuPage::render() {
+    renderRows(ALL_ROWS);
+}
+
+/**
+ * @brief Repaints the title and the entries that touch the given rows
+ * @param rows Bit r set = repaint LCD row r
+ * @details A two-row entry is redrawn whole if either of its rows is set.
+ */
+void MenuPage::renderRows(uint8_t rows) {
+    char line[LCD_COLS];
+    if (rows & 1) {
+        TextFormat::putLabel(line, LCD_COLS, _title);
+        IDisplay::instance().setCursor(0, 0);
+        IDisplay::instance().write(line, LCD_COLS);
+    }
+    
+    size_t count = getItemsCount();
+    size_t max_lines = 3;
+    size_t scroll_offset = _scroll_offset;
+    
+    size_t itemIdx = scroll_offset;
+    uint8_t row = 1;
+    while (row <= max_lines) {
+        char mark = ' ';
+        if (row == 1 && scroll_offset > 0) mark = '^';
+        if (row == max_lines && scroll_offset + max_lines < count) mark = 'v';
+
+        if (itemIdx < count) {
+            uint8_t height = getRowHeight(itemIdx);
+            if (rows & (((1 << height) - 1) << row)) {
+                drawRow(itemIdx, row, itemIdx == _selected_index);
+                if (height == 1) {
+                    IDisplay::instance().setCursor(MENU_ITEM_COLS, row);
+                    IDisplay::instance().writeChar(mark);
+                }
+            }
+            row += height;
+            itemIdx++;
+        } else {
+            if (rows & (1 << row)) {
+                TextFormat::fill(line, LCD_COLS);
+                line[MENU_ITEM_COLS] = mark;
+                IDisplay::instance().setCursor(0, row);
+                IDisplay::instance().write(line, LCD_COLS);
+            }
+            row++;
+        }
+    }
+}
+
+/**
+ * @brief Private constructor for singleton pattern
+ */
+PageCache::PageCache() : _count(0), _bytes(0), _refusedNext(0) {
+    for (uint8_t i = 0; i < REFUSED_SLOTS; i++) _refused[i] = nullptr;
+}
+
+/**
+ * @brief Gets the singleton instance
+ * @return Reference to PageCache instance
+ */
+PageCache& PageCache::instance() {
+    static PageCache inst;
+    return inst;
+}
+
+/**
+ * @brief Removes a page from the cache, keeping the LRU order of the rest
+ * @param index Slot index
+ * @return The removed page
+ */
+MenuPage* PageCache::take(uint8_t index) {
+    MenuPage* page = _pages[index];
+    for (uint8_t i = index; i + 1 < _count; i++) {
+        _pages[i] = _pages[i + 1];
+    }
+    _count--;
+    _bytes -= page->_footprint;
+    return page;
+}
+
+/**
+ * @brief Deletes the least recently used page
+ */
+void PageCache::evictOldest() {
+    if (_count > 0) delete take(_count - 1);
+}
+
+/**
+ * @brief Finds the slot holding a page key
+ * @param builder Page builder
+ * @param context Context passed to builder
+ * @return Slot index, or SLOTS if not cached
+ */
+uint8_t PageCache::find(PageBuilder builder, void* context) const {
+    for (uint8_t i = 0; i < _count; i++) {
+        if (_pages[i]->_origin == builder && _pages[i]->_originContext == context) {
+            return i;
+        }
+    }
+    return SLOTS;
+}
+
+/**
+ * @brief Runs a builder and records the page key and footprint
+ * @param builder Page builder
+ * @param context Context passed to builder
+ * @return New page, or nullptr
+ * @details The footprint is summed from the page's own contents rather
+ * than the drop in free RAM, which misses blocks recycled from the free list.
+ */
+MenuPage* PageCache::build(PageBuilder builder, void* context) {
+    MenuPage* page = builder(context);
+    if (!page) return nullptr;
+
+    page->_origin = builder;
+    page->_originContext = context;
+    page->_footprint = page->footprint() + MenuPage::HEAP_HEADER;
+    return page;
+}
+
+/**
+ * @brief Returns a cached page or runs the builder
+ * @param builder Page builder
+ * @param context Context passed to builder
+ * @return Page ready to push, or nullptr
+ */
+MenuPage* PageCache::open(PageBuilder builder, void* context) {
+    uint8_t slot = find(builder, context);
+    if (slot < SLOTS) {
+        MenuPage* page = take(slot);
+        page->_parent = NavigationManager::instance().getCurrentPage();
+        return page;
+    }
+
+    trim();
+    MenuPage* page = build(builder, context);
+    if (!page && _count > 0) {
+        clear();
+        page = build(builder, context);
+    }
+    return page;
+}
+
+/**
+ * @brief Parks a popped page as the most recently used entry
+ * @param page Page removed from the navigation stack
+ * @return True if the cache now owns the page
+ */
+bool PageCache::store(MenuPage* page) {
+    if (!page->_origin || page->_footprint > BUDGET_BYTES || !page->isCacheable()) {
+        return false;
+    }
+
+    while (_count > 0 && (_count == SLOTS || _bytes + page->_footprint > BUDGET_BYTES)) {
+        evictOldest();
+    }
+    for (uint8_t i = _count; i > 0; i--) {
+        _pages[i] = _pages[i - 1];
+    }
+    _pages[0] = page;
+    _count++;
+    _bytes += page->_footprint;
+    trim();
+    return true;
+}
+
+/**
+ * @brief Builds a page ahead of ENTER when RAM allows
+ * @param builder Page builder
+ * @param context Context passed to builder
+ */
+void PageCache::prefetch(PageBuilder builder, void* context) {
+    if (find(builder, context) < SLOTS) return;
+    for (uint8_t i = 0; i < REFUSED_SLOTS; i++) {
+        if (_refused[i] == builder) return;
+    }
+    if (getFreeMemory() < PREFETCH_FREE_RAM) return;
+
+    MenuPage* page = build(builder, context);
+    if (page && !store(page)) {
+        delete page;
+        _refused[_refusedNext] = builder;
+        _refusedNext = (_refusedNext + 1) % REFUSED_SLOTS;
+    }
+}
+
+/**
+ * @brief Evicts pages while MemoryMonitor reports low free RAM
+ */
+void PageCache::trim() {
+    while (_count > 0 && getFreeMemory() < MIN_FREE_RAM) {
+        evictOldest();
+    }
+}
+
+/**
+ * @brief Deletes every cached page
+ */
+void PageCache::clear() {
+    while (_count > 0) evictOldest();
+}
+
 /**
  * @brief Private constructor for singleton pattern
  */
-NavigationManager::NavigationManager() : _initialized(false) {}
+NavigationManager::NavigationManager() 
+    : _initialized(false), _idle(false), _prefetched(false), _repeatStep(0),
+      _cursorMoved(false), _cursorFrom(0), _marqueeOffset(NO_MARQUEE),
+      _marqueeNext(0), _toastRows(0), _toastUntil(0),
+      _navFrameMs(1000 / NAV_FPS), _liveFrameMs(1000 / LIVE_FPS), _frameStart(0),
+      _inputSinceFrame(false), _frameCount(0), _fps(0), _fpsWindowStart(0),
+      _request(nullptr), _requestContext(nullptr), _latencyPending(false),
+      _latencyStamp(0), _lastActivity(0) {
+    EventSystem::instance().addListener(this, EventType::DeviceStateChanged);
+    EventSystem::instance().addListener(this, EventType::DeviceValueChanged);
+    EventSystem::instance().addListener(this, EventType::SensorUpdated);
+    EventSystem::instance().addListener(this, EventType::AlarmTriggered);
+}
 
 /**
  * @brief Gets the singleton instance
@@ -226,18 +662,22 @@ void NavigationManager::setLCD() {
 // cppcheck-suppress unusedFunction
 void NavigationManager::initialize(MenuPage* root) {
     _stack.add(root);
+    _lastActivity = millis();
     draw();
 }
 
 /**
  * @brief Pushes a new page onto the navigation stack
  * @param page Heap-allocated page to display
+ * @details The page is drawn by the next frame in update().
  */
 void NavigationManager::pushPage(MenuPage* page) {
     if (page) {
+        MenuPage* top = getCurrentPage();
+        if (top) top->onCovered();
         _stack.add(page);
         page->forceRedraw();
-        draw();
+        resetMarquee();
     }
 }
 
@@ -248,10 +688,10 @@ void NavigationManager::navigateBack() {
     if (_stack.size() > 1) {
         MenuPage* current = _stack[_stack.size() - 1];
         _stack.remove(_stack.size() - 1);
-        delete current;
+        if (!PageCache::instance().store(current)) delete current;
         
         getCurrentPage()->forceRedraw();
-        draw();
+        resetMarquee();
     }
 }
 
@@ -267,156 +707,590 @@ MenuPage* NavigationManager::getCurrentPage() {
 /**
  * @brief Delegates input event to current page
  * @param event Input event to handle
+ * @param repeatStep Step multiplier for auto-repeated keys (0 = single press)
  */
-void NavigationManager::handleInput(InputEvent event) {
+void NavigationManager::handleInput(InputEvent event, uint8_t repeatStep) {
     MenuPage* current = getCurrentPage();
     if (!current) return;
+
+    _repeatStep = repeatStep;
+    rewindMarquee();
+
+    _lastActivity = millis();
+    _prefetched = false;
+    _inputSinceFrame = true;
+    if (_idle) wake();
+    if (_toastRows) hideToast();
     
     if (event == InputEvent::BACK) {
         navigateBack();
     } else if (event == InputEvent::ENTER) {
-        size_t idx = current->getSelectedIndex();
-        if (idx < current->getItemsCount()) {
-            MenuItem* item = current->getItem(idx);
-            if (item->getType() == MenuItemType::SUBMENU) {
-                SubMenuItem* sub = static_cast<SubMenuItem*>(item);
-                MenuPage* newPage = sub->createPage();
-                pushPage(newPage);
-            } else {
-                item->handleInput(event);
-            }
+        MenuPage* newPage = current->handleEnter();
+        if (newPage) {
+            pushPage(newPage);
+        } else if (getCurrentPage() == current) {
+            // Item acted in place (toggle, calibration): refresh just its row
+            current->markDirty(current->_selected_index);
         }
     } else {
         current->handleInput(event);
     }
-    
-    if (getCurrentPage()) getCurrentPage()->forceRedraw();
 }
 
 /**
- * @brief Updates display if current page needs redrawing
+ * @brief Dispatches all queued input to the current page
  */
-void NavigationManager::update() {
-    MenuPage* current = getCurrentPage();
-    if (current && current->needsRedraw()) {
-        draw();
-        current->clearRedraw();
+void NavigationManager::drainInput() {
+    InputQueue::Entry input;
+    while (InputQueue::instance().pop(input)) {
+        if (!_latencyPending) {
+            _latencyPending = true;
+            _latencyStamp = input.stamp;
+        }
+
+        for (uint8_t i = 0; i < input.count; i++) {
+            handleInput(input.event, input.step);
+        }
     }
 }
 
 /**
- * @brief Incrementally updates cursor without full redraw
- * @param oldIndex Previous selection index
- * @param newIndex New selection index
+ * @brief Shows the start of the selected label and waits before scrolling
+ * @details Whether the label fits is checked on the next due tick, so rows
+ * that need no scrolling cost one check per hold period.
  */
-void NavigationManager::drawIncrementalCursor(size_t oldIndex, size_t newIndex) {
-    MenuPage* current = getCurrentPage();
-    if (!current || !_initialized) return;
+void NavigationManager::resetMarquee() {
+    _marqueeOffset = 0;
+    _marqueeNext = millis() + MARQUEE_HOLD_MS;
+}
 
-    size_t scroll_offset = current->_scroll_offset;
-    
-    if (oldIndex >= scroll_offset && oldIndex < scroll_offset + 3) {
-        size_t row = oldIndex - scroll_offset + 1;
-        LCD_set_cursor(0, row);
-        LCD_write_str("                    ");
-        current->getItem(oldIndex)->draw(row, false);
-    }
-    
-    if (newIndex >= scroll_offset && newIndex < scroll_offset + 3) {
-        size_t row = newIndex - scroll_offset + 1;
-        LCD_set_cursor(0, row);
-        LCD_write_str("                    ");
-        current->getItem(newIndex)->draw(row, true);
+/**
+ * @brief Shows the selected label from its start again and restarts the marquee
+ * @details Partial redraws (drawValue(), rows under a notification) leave
+ * the label as the marquee last drew it, so a scrolled label is rewound
+ * here before the offset goes back to 0.
+ */
+void NavigationManager::rewindMarquee() {
+    if (_marqueeOffset != NO_MARQUEE && _marqueeOffset != 0 && _initialized) {
+        uint8_t row, col, width, len;
+        const char* text = marqueeLabel(row, col, width, len);
+        if (text && len > width && _marqueeOffset <= len - width) {
+            writeMarquee(text, row, col, width, _marqueeOffset, 0);
+        }
     }
+    resetMarquee();
 }
 
 /**
- * @brief Renders full page with title, items, and scroll indicators
+ * @brief Finds the label field of the selected row
+ * @param row Receives the LCD row
+ * @param col Receives the first column of the field
+ * @param width Receives the field width
+ * @param len Receives the label length
+ * @return Label in PROGMEM, or nullptr if the row is not on screen
  */
-void NavigationManager::draw() {
+const char* NavigationManager::marqueeLabel(uint8_t& row, uint8_t& col, uint8_t& width, uint8_t& len) {
+    len = 0;
     MenuPage* current = getCurrentPage();
-    if (!current || !_initialized) return;
+    if (!current) return nullptr;
 
-    LCD_clear();
-    LCD_set_cursor(0, 0);
-    printLabel(current->_title);
-    
-    size_t count = current->getItemsCount();
-    size_t max_lines = 3;
-    size_t scroll_offset = current->_scroll_offset;
-    
-    for (size_t i = 0; i < min(count - scroll_offset, max_lines); i++) {
-        size_t itemIdx = i + scroll_offset;
-        MenuItem* item = current->getItem(itemIdx);
-        item->draw(i + 1, itemIdx == current->getSelectedIndex());
-    }
-    
-    if (scroll_offset > 0) {
-        LCD_set_cursor(19, 1);
-        LCD_write_char('^');
-    }
-    if (scroll_offset + max_lines < count) {
-        LCD_set_cursor(19, 3);
-        LCD_write_char('v');
+    size_t index = current->_selected_index;
+    if (index < current->_scroll_offset) return nullptr;
+    row = 1;
+    for (size_t i = current->_scroll_offset; i < index && row < LCD_ROWS; i++) {
+        row += current->getRowHeight(i);
     }
+    if (row >= LCD_ROWS) return nullptr;
+
+    col = 0;
+    width = 0;
+    const __FlashStringHelper* label = current->getRowLabel(index, col, width);
+    const char* text = reinterpret_cast<const char*>(label);
+    len = label ? static_cast<uint8_t>(strlen_P(text)) : 0;
+    return text;
 }
 
 /**
- * @brief Helper to print Flash string to LCD
- * @param f_str Flash string pointer
- */
-void NavigationManager::printLabel(const __FlashStringHelper* f_str) {
-    char buf[21];
-    strncpy_P(buf, reinterpret_cast<const char*>(f_str), 20);
-    buf[20] = 0;
-    LCD_write_str(buf);
+ * @brief Moves the label window, rewriting only the cells that change
+ * @param text Label in PROGMEM
+ * @param row LCD row
+ * @param col First column of the field
+ * @param width Field width
+ * @param from Offset currently shown
+ * @param to Offset to show
+ */
+void NavigationManager::writeMarquee(const char* text, uint8_t row, uint8_t col, uint8_t width,
+                                     uint8_t from, uint8_t to) {
+    // Rewrite each run of cells whose character differs from the shown one
+    char cells[LCD_COLS];
+    uint8_t i = 0;
+    while (i < width) {
+        uint8_t start = i;
+        uint8_t n = 0;
+        while (i < width) {
+            char c = pgm_read_byte(text + to + i);
+            if (c == static_cast<char>(pgm_read_byte(text + from + i))) break;
+            cells[n++] = c;
+            i++;
+        }
+        if (n > 0) {
+            IDisplay::instance().setCursor(col + start, row);
+            IDisplay::instance().write(cells, n);
+        } else {
+            i++;
+        }
+    }
 }
 
 /**
- * @brief Constructs device toggle item
- * @param device Device to control
+ * @brief Advances the selected row's label by one character
+ * @details Scrolls until the last character is visible, holds, then jumps
+ * back to the start. Cells that keep their character are not rewritten.
  */
-DeviceToggleItem::DeviceToggleItem(IDevice* device) : _device(device) {}
+void NavigationManager::tickMarquee() {
+    if (_marqueeOffset == NO_MARQUEE || !_initialized) return;
+    if (static_cast<long>(millis() - _marqueeNext) < 0) return;
+
+    uint8_t row, col, width, len;
+    const char* text = marqueeLabel(row, col, width, len);
+    if (!text || len <= width) {
+        _marqueeOffset = NO_MARQUEE;
+        return;
+    }
+
+    uint8_t last = len - width;
+    uint8_t from = _marqueeOffset;
+    _marqueeOffset = (from >= last) ? 0 : from + 1;
+    bool atEnd = _marqueeOffset == 0 || _marqueeOffset == last;
+    _marqueeNext = millis() + (atEnd ? MARQUEE_HOLD_MS : MARQUEE_STEP_MS);
+
+    writeMarquee(text, row, col, width, from, _marqueeOffset);
+}
 
 /**
- * @brief Checks if this item relates to specified device
- * @param dev Device to check
- * @return True if this item controls the device
+ * @brief Queues a page to open in the next update()
+ * @param builder Page builder
+ * @param context Context passed to builder
  */
-bool DeviceToggleItem::relatesTo(IDevice* dev) { 
-    return _device == dev; 
+// cppcheck-suppress unusedFunction
+void NavigationManager::requestPage(PageBuilder builder, void* context) {
+    _request = builder;
+    _requestContext = context;
 }
 
 /**
- * @brief Renders toggle item with device name and state
- * @param row LCD row to draw on
- * @param selected True if item is selected
+ * @brief Gets the step multiplier of the event being handled
+ * @return 0 for a single press, 1-4 while a key auto-repeats
  */
-void DeviceToggleItem::draw(uint8_t row, bool selected) {
-    LCD_set_cursor(0, row);
-    LCD_write_str(selected ? "> " : "  ");
-    printLabel(_device->name);
-    LCD_set_cursor(15, row);
-    
-    if (_device->isLight()) {
-        const SimpleLight* light = static_cast<const SimpleLight*>(_device);
-        LCD_write_str(light->getState() ? "ON " : "OFF");
-    }
+uint8_t NavigationManager::getRepeatStep() const {
+    return _repeatStep;
 }
 
 /**
- * @brief Handles input for device toggle
- * @param event Input event
- * @return True if event was handled
+ * @brief Updates display if current page needs redrawing
  */
-bool DeviceToggleItem::handleInput(InputEvent event) {
-    if (event == InputEvent::ENTER && _device->isLight()) {
-        static_cast<SimpleLight*>(_device)->toggle();
-        return true;
+void NavigationManager::update() {
+    drainInput();
+    if (_request) {
+        PageBuilder builder = _request;
+        _request = nullptr;
+        _lastActivity = millis();
+        _prefetched = false;
+        _inputSinceFrame = true;
+        if (_idle) wake();
+        if (_toastRows) hideToast();
+        // A repeated request for the page already on top must not stack copies
+        MenuPage* top = getCurrentPage();
+        if (!top || top->_origin != builder || top->_originContext != _requestContext) {
+            // Release the page's glyphs before the new page loads its own
+            if (top) top->onCovered();
+            MenuPage* page = PageCache::instance().open(builder, _requestContext);
+            if (page) {
+                pushPage(page);
+            } else if (top) {
+                top->forceRedraw();
+            }
+        }
+    }
+    PageCache::instance().trim();
+
+    if (!_idle && _initialized && !_toastRows && millis() - _lastActivity >= IDLE_TIMEOUT_MS) {
+        _idle = true;
+        IDisplay::instance().setPower(false);
+    }
+    if (_idle) return;
+
+    if (_toastRows && static_cast<long>(millis() - _toastUntil) >= 0) hideToast();
+
+    unsigned long now = millis();
+    if (now - _fpsWindowStart >= FPS_WINDOW_MS) {
+        _fps = _frameCount;
+        _frameCount = 0;
+        _fpsWindowStart = now;
+    }
+
+    MenuPage* current = getCurrentPage();
+    if (current) current->tick();
+
+    // Changes requested before the frame period is over wait for the next frame
+    uint16_t period = _inputSinceFrame ? _navFrameMs : _liveFrameMs;
+    bool drew = false;
+    if (current && now - _frameStart >= period) {
+        if (current->needsRedraw()) {
+            draw();
+            current->clearRedraw();
+            _cursorMoved = false;
+            resetMarquee();
+            if (_toastRows) drawToast();
+            drew = true;
+        } else {
+            if (_cursorMoved) drew = drawCursor();
+            if (current->hasDirtyRows() && _initialized) {
+                // Items under the notification stay dirty until it is removed
+                current->renderDirty(toastMask());
+                drew = true;
+            }
+        }
+        if (!drew && !_prefetched && millis() - _lastActivity >= PREFETCH_DELAY_MS) {
+            // Nothing to draw and the cursor is at rest: build the next page now
+            _prefetched = true;
+            current->prefetchSelected();
+        }
+    }
+
+    if (!_toastRows) tickMarquee();
+
+    // Buffered backends send this frame's changes (incl. cursor moves) here
+    IDisplay::instance().flush();
+
+    if (drew) {
+        _frameStart = now;
+        _inputSinceFrame = false;
+        if (_frameCount < 255) _frameCount++;
+    }
+
+    current = getCurrentPage();
+    if (_latencyPending && current && !_cursorMoved && !current->needsRedraw() && !current->hasDirtyRows()) {
+        _latencyPending = false;
+        uint16_t elapsed = static_cast<uint16_t>(millis()) - _latencyStamp;
+        UiLatencySensor::registerLatency(elapsed, current->_title);
+    }
+}
+
+/**
+ * @brief Forwards a device event to the page on top of the stack
+ * @details AlarmTriggered raises the alarm notification instead.
+ * @param type Event type received
+ * @param device Device that triggered the event
+ * @param value Event-specific value
+ */
+void NavigationManager::handleEvent(EventType type, IDevice* device, int value) {
+    if (type == EventType::AlarmTriggered) {
+        notify(F("Alarm triggered"), F("Motion detected"));
+        return;
+    }
+    if (_idle) return;
+    MenuPage* current = getCurrentPage();
+    if (current) current->handleEvent(type, device, value);
+}
+
+/**
+ * @brief Sets the frame rate caps
+ * @param navFps Frames per second allowed right after input (1-50)
+ * @param liveFps Frames per second allowed for live value updates (1-50)
+ */
+// cppcheck-suppress unusedFunction
+void NavigationManager::setFrameRates(uint8_t navFps, uint8_t liveFps) {
+    _navFrameMs = 1000 / constrain(navFps, 1, 50);
+    _liveFrameMs = 1000 / constrain(liveFps, 1, 50);
+}
+
+/**
+ * @brief Gets the frame cap used after input
+ * @return Frames per second
+ */
+int16_t NavigationManager::getNavFrameCap() const {
+    return 1000 / _navFrameMs;
+}
+
+/**
+ * @brief Gets the frame cap used for live value updates
+ * @return Frames per second
+ */
+int16_t NavigationManager::getLiveFrameCap() const {
+    return 1000 / _liveFrameMs;
+}
+
+/**
+ * @brief Gets the achieved frame rate
+ * @return Frames drawn during the last complete second
+ */
+int16_t NavigationManager::getFrameRate() const {
+    return _fps;
+}
+
+/**
+ * @brief Shows a notification over the current page for a while
+ * @param line1 First line (Flash string)
+ * @param line2 Second line (Flash string), nullptr for a single row
+ * @param durationMs Time before the covered rows are restored
+ */
+// cppcheck-suppress unusedFunction
+void NavigationManager::notify(const __FlashStringHelper* line1, const __FlashStringHelper* line2,
+                               uint16_t durationMs) {
+    uint8_t previous = toastMask();
+    _toast[0] = line1;
+    _toast[1] = line2;
+    _toastRows = line2 ? 2 : 1;
+    _toastUntil = millis() + durationMs;
+
+    if (_idle) {
+        // wake() schedules a full redraw; update() draws the toast after it
+        wake();
+        return;
+    }
+    MenuPage* current = getCurrentPage();
+    uint8_t uncovered = previous & ~toastMask();
+    if (uncovered && current && _initialized) current->renderRows(uncovered);
+    drawToast();
+}
+
+/**
+ * @brief Gets the LCD rows covered by the notification
+ * @return Row mask, 0 when no notification is shown
+ */
+uint8_t NavigationManager::toastMask() const {
+    return static_cast<uint8_t>(((1 << _toastRows) - 1) << TOAST_ROW);
+}
+
+/**
+ * @brief Writes each notification line centered between two block borders
+ */
+void NavigationManager::drawToast() {
+    if (!_initialized) return;
+    char line[LCD_COLS];
+    for (uint8_t i = 0; i < _toastRows; i++) {
+        const char* text = reinterpret_cast<const char*>(_toast[i]);
+        uint8_t len = static_cast<uint8_t>(strlen_P(text));
+        if (len > LCD_COLS - 2) len = LCD_COLS - 2;
+        uint8_t start = 1 + (LCD_COLS - 2 - len) / 2;
+
+        TextFormat::fill(line, LCD_COLS);
+        line[0] = TOAST_BORDER;
+        line[LCD_COLS - 1] = TOAST_BORDER;
+        TextFormat::putLabel(line + start, LCD_COLS - 1 - start, _toast[i]);
+        IDisplay::instance().setCursor(0, TOAST_ROW + i);
+        IDisplay::instance().write(line, LCD_COLS);
+    }
+}
+
+/**
+ * @brief Removes the notification and repaints the rows it covered
+ * @details The rest of the screen was kept up to date underneath, so only
+ * the covered rows are redrawn from the current page.
+ */
+void NavigationManager::hideToast() {
+    uint8_t rows = toastMask();
+    _toastRows = 0;
+    rewindMarquee();
+    MenuPage* current = getCurrentPage();
+    if (current && _initialized) current->renderRows(rows);
+}
+
+/**
+ * @brief Checks whether the UI is idle (backlight off)
+ * @return True if idle
+ */
+bool NavigationManager::isIdle() const {
+    return _idle;
+}
+
+/**
+ * @brief Turns the backlight back on and schedules a full redraw
+ * @details Live values kept changing while idle, so the frame on the
+ * LCD is stale and must be repainted once.
+ */
+void NavigationManager::wake() {
+    _idle = false;
+    IDisplay::instance().setPower(true);
+    MenuPage* current = getCurrentPage();
+    if (current) current->forceRedraw();
+}
+
+/**
+ * @brief Records a cursor move for an incremental redraw
+ * @param oldIndex Previous selection index
+ * @param newIndex New selection index
+ * @details Only the first origin is kept, so several moves before the next
+ * frame redraw just the row shown selected and the final one.
+ */
+void NavigationManager::drawIncrementalCursor(size_t oldIndex, size_t newIndex) {
+    static_cast<void>(newIndex);
+    if (!_cursorMoved) _cursorFrom = oldIndex;
+    _cursorMoved = true;
+}
+
+/**
+ * @brief Redraws the rows of a recorded cursor move without a full redraw
+ * @return True if any row was drawn
+ */
+bool NavigationManager::drawCursor() {
+    _cursorMoved = false;
+    MenuPage* current = getCurrentPage();
+    if (!current || !_initialized) return false;
+
+    size_t scroll_offset = current->_scroll_offset;
+    size_t oldIndex = _cursorFrom;
+    size_t newIndex = current->_selected_index;
+    if (oldIndex == newIndex) return false;
+    
+    if (oldIndex >= scroll_offset && oldIndex < scroll_offset + 3) {
+        current->drawRow(oldIndex, oldIndex - scroll_offset + 1, false);
+    }
+    
+    if (newIndex >= scroll_offset && newIndex < scroll_offset + 3) {
+        current->drawRow(newIndex, newIndex - scroll_offset + 1, true);
+    }
+    return true;
+}
+
+/**
+ * @brief Renders the current page if the display is ready
+ */
+void NavigationManager::draw() {
+    MenuPage* current = getCurrentPage();
+    if (!current || !_initialized) return;
+    current->render();
+}
+
+/**
+ * @brief Constructs device toggle item
+ * @param device Device to control
+ */
+DeviceToggleItem::DeviceToggleItem(IDevice* device) : _device(device) {}
+
+/**
+ * @brief Checks if this item relates to specified device
+ * @param dev Device to check
+ * @return True if this item controls the device
+ */
+bool DeviceToggleItem::relatesTo(IDevice* dev) { 
+    return _device == dev; 
+}
+
+/**
+ * @brief Renders toggle item with device name and state
+ * @param row LCD row to draw on
+ * @param selected True if item is selected
+ */
+void DeviceToggleItem::draw(uint8_t row, bool selected) {
+    const __FlashStringHelper* state = nullptr;
+    if (_device->isLight()) {
+        const SimpleLight* light = static_cast<const SimpleLight*>(_device);
+        state = light->getState() ? F("ON") : F("OFF");
+    }
+
+    char line[MENU_ITEM_COLS];
+    formatStateRow(line, selected, nullptr, _device->name, state);
+    writeRow(row, line, MENU_ITEM_COLS);
+}
+
+/**
+ * @brief Reports the device name field left of the state column
+ * @param col Receives the first column of the label field
+ * @param width Receives the field width in cells
+ * @return Device name
+ */
+const __FlashStringHelper* DeviceToggleItem::getLabel(uint8_t& col, uint8_t& width) const {
+    col = 2;
+    width = STATE_COL - 3;
+    return _device->name;
+}
+
+/**
+ * @brief Rewrites only the ON/OFF field
+ * @param row LCD row
+ * @param selected Unused
+ */
+void DeviceToggleItem::drawValue(uint8_t row, bool selected) {
+    static_cast<void>(selected);
+    const __FlashStringHelper* state = nullptr;
+    if (_device->isLight()) {
+        state = static_cast<const SimpleLight*>(_device)->getState() ? F("ON") : F("OFF");
+    }
+    writeStateField(row, state);
+}
+
+/**
+ * @brief Handles input for device toggle
+ * @param event Input event
+ * @return True if event was handled
+ */
+bool DeviceToggleItem::handleInput(InputEvent event) {
+    if (event == InputEvent::ENTER && _device->isLight()) {
+        static_cast<SimpleLight*>(_device)->toggle();
+        return true;
     }
     return false;
 }
 
+/**
+ * @brief Constructs a latency breakdown row
+ * @param sensor Latency sensor device
+ * @param slot Page slot to show
+ */
+PageLatencyItem::PageLatencyItem(UiLatencySensorDevice* sensor, uint8_t slot)
+    : _sensor(sensor), _slot(slot) {}
+
+/**
+ * @brief Refreshes when the latency sensor reports
+ * @param dev Device to check
+ * @return True for the latency sensor
+ */
+bool PageLatencyItem::relatesTo(IDevice* dev) {
+    return _sensor == dev;
+}
+
+/**
+ * @brief Formats the page average and max, capped at 999 ms
+ * @param cells MENU_ITEM_COLS - VALUE_COL cells
+ */
+void PageLatencyItem::formatValue(char* cells) const {
+    const UiLatencySensor::PageLatency& page = _sensor->getPage(_slot);
+    if (page.count == 0) {
+        TextFormat::fill(cells, MENU_ITEM_COLS - VALUE_COL);
+        return;
+    }
+    uint32_t avg = page.sum / page.count;
+    cells[0] = ' ';
+    TextFormat::putUInt(cells + 1, 3, avg > 999 ? 999 : static_cast<uint16_t>(avg));
+    cells[4] = '/';
+    TextFormat::putUInt(cells + 5, 3, page.max > 999 ? 999 : page.max);
+}
+
+/**
+ * @brief Renders the page title followed by "avg/max"
+ * @param row LCD row to draw on
+ * @param selected True if item is selected
+ */
+void PageLatencyItem::draw(uint8_t row, bool selected) {
+    char line[MENU_ITEM_COLS];
+    putCursor(line, selected);
+    const __FlashStringHelper* title = _sensor->getPage(_slot).title;
+    TextFormat::putLabel(line + 2, VALUE_COL - 2, title ? title : F("-"));
+    formatValue(line + VALUE_COL);
+    writeRow(row, line, MENU_ITEM_COLS);
+}
+
+/**
+ * @brief Redraws the whole row: a slot may have switched to another page
+ * @param row LCD row the item starts on
+ * @param selected True if item is selected
+ */
+void PageLatencyItem::drawValue(uint8_t row, bool selected) {
+    draw(row, selected);
+}
+
 /**
  * @brief Constructs PIR live display item
  * @param sensor PIR sensor device to display
@@ -438,11 +1312,20 @@ bool LivePIRItem::relatesTo(IDevice* dev) {
  * @param selected True if item is selected
  */
 void LivePIRItem::draw(uint8_t row, bool selected) {
-    LCD_set_cursor(0, row);
-    LCD_write_str(selected ? "> " : "  ");
-    printLabel(_sensor->name);
-    LCD_write_str(": ");
-    LCD_write_str(_sensor->isMotionDetected() ? "Yes" : "No");
+    char line[MENU_ITEM_COLS];
+    formatStateRow(line, selected, nullptr, _sensor->name,
+                   _sensor->isMotionDetected() ? F("Yes") : F("No"));
+    writeRow(row, line, MENU_ITEM_COLS);
+}
+
+/**
+ * @brief Rewrites only the Yes/No field
+ * @param row LCD row
+ * @param selected Unused
+ */
+void LivePIRItem::drawValue(uint8_t row, bool selected) {
+    static_cast<void>(selected);
+    writeStateField(row, _sensor->isMotionDetected() ? F("Yes") : F("No"));
 }
 
 /**
@@ -465,184 +1348,838 @@ LightCalibrationItem::LightCalibrationItem(const __FlashStringHelper* label, Pho
     : _label(label), _sensor(sensor), _isDark(isDark) {}
 
 /**
- * @brief Renders calibration item
- * @param row LCD row to draw on
- * @param selected True if item is selected
+ * @brief Renders calibration item
+ * @param row LCD row to draw on
+ * @param selected True if item is selected
+ */
+void LightCalibrationItem::draw(uint8_t row, bool selected) {
+    char line[MENU_ITEM_COLS];
+    putCursor(line, selected);
+    TextFormat::putLabel(line + 2, MENU_ITEM_COLS - 2, _label);
+    writeRow(row, line, MENU_ITEM_COLS);
+}
+
+/**
+ * @brief Handles calibration action on ENTER
+ * @param event Input event
+ * @return True if calibration was performed
+ */
+bool LightCalibrationItem::handleInput(InputEvent event) {
+    if (event == InputEvent::ENTER) {
+        if (_isDark) {
+            _sensor->calibrateCurrentAsMin();
+        } else {
+            _sensor->calibrateCurrentAsMax();
+        }
+        _sensor->getStats().reset();
+        EventSystem::instance().emit(EventType::SensorUpdated, _sensor, _sensor->getValue());
+        NavigationManager::instance().notify(F("Calibrated"), _label);
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Constructs action item with callback
+ * @param label Display label
+ * @param device Target device for action
+ * @param action Function pointer to execute
+ * @param param Parameter to pass to action
+ */
+ActionItem::ActionItem(const __FlashStringHelper* label, IDevice* device, void (*action)(IDevice*, int), int param)
+    : _device(device), _label(label), _action(action), _param(param) {}
+
+/**
+ * @brief Renders action item
+ * @param row LCD row to draw on
+ * @param selected True if item is selected
+ */
+void ActionItem::draw(uint8_t row, bool selected) {
+    char line[MENU_ITEM_COLS];
+    putCursor(line, selected);
+    TextFormat::putLabel(line + 2, MENU_ITEM_COLS - 2, _label);
+    writeRow(row, line, MENU_ITEM_COLS);
+}
+
+/**
+ * @brief Reports the label field
+ * @param col Receives the first column of the label field
+ * @param width Receives the field width in cells
+ * @return Action label
+ */
+const __FlashStringHelper* ActionItem::getLabel(uint8_t& col, uint8_t& width) const {
+    col = 2;
+    width = MENU_ITEM_COLS - 2;
+    return _label;
+}
+
+/**
+ * @brief Executes action and navigates back on ENTER
+ * @param event Input event
+ * @return True if action was executed
+ */
+bool ActionItem::handleInput(InputEvent event) {
+    if (event == InputEvent::ENTER) {
+        _action(_device, _param);
+        NavigationManager::instance().navigateBack();
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Constructs submenu item with JIT page builder
+ * @param label Display label
+ * @param builder Function that creates the submenu page
+ * @param context Context data passed to builder
+ */
+SubMenuItem::SubMenuItem(const __FlashStringHelper* label, PageBuilder builder, void* context)
+    : _label(label), _builder(builder), _context(context) {}
+
+/**
+ * @brief Returns item type for polymorphic dispatch
+ * @return MenuItemType::SUBMENU
+ */
+MenuItemType SubMenuItem::getType() const { 
+    return MenuItemType::SUBMENU; 
+}
+
+/**
+ * @brief Opens the submenu page, reusing a cached one when available
+ * @return Heap-allocated menu page
+ */
+MenuPage* SubMenuItem::createPage() const { 
+    return PageCache::instance().open(_builder, _context);
+}
+
+/**
+ * @brief Builds the submenu page into PageCache ahead of ENTER
+ */
+void SubMenuItem::prefetchPage() const {
+    PageCache::instance().prefetch(_builder, _context);
+}
+
+/**
+ * @brief Renders submenu item with arrow indicator
+ * @param row LCD row to draw on
+ * @param selected True if item is selected
+ */
+void SubMenuItem::draw(uint8_t row, bool selected) {
+    char line[MENU_ITEM_COLS];
+    putCursor(line, selected);
+    TextFormat::putLabel(line + 2, MENU_ITEM_COLS - 4, _label);
+    line[MENU_ITEM_COLS - 2] = ' ';
+    line[MENU_ITEM_COLS - 1] = '>';
+    writeRow(row, line, MENU_ITEM_COLS);
+}
+
+/**
+ * @brief Reports the label field left of the arrow
+ * @param col Receives the first column of the label field
+ * @param width Receives the field width in cells
+ * @return Submenu label
+ */
+const __FlashStringHelper* SubMenuItem::getLabel(uint8_t& col, uint8_t& width) const {
+    col = 2;
+    width = MENU_ITEM_COLS - 4;
+    return _label;
+}
+
+/**
+ * @brief Handles submenu navigation on ENTER
+ * @param event Input event
+ * @return True if navigation occurred
+ */
+bool SubMenuItem::handleInput(InputEvent event) {
+    if (event == InputEvent::ENTER) {
+        MenuPage* newPage = createPage();
+        NavigationManager::instance().pushPage(newPage);
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Constructs back navigation item
+ */
+BackMenuItem::BackMenuItem() {}
+
+/**
+ * @brief Renders back item
+ * @param row LCD row to draw on
+ * @param selected True if item is selected
+ */
+void BackMenuItem::draw(uint8_t row, bool selected) {
+    char line[MENU_ITEM_COLS];
+    putCursor(line, selected);
+    TextFormat::putLabel(line + 2, MENU_ITEM_COLS - 2, F("<< Back"));
+    writeRow(row, line, MENU_ITEM_COLS);
+}
+
+/**
+ * @brief Handles back navigation on ENTER
+ * @param event Input event
+ * @return True if navigation occurred
+ */
+bool BackMenuItem::handleInput(InputEvent event) {
+    if (event == InputEvent::ENTER) {
+        NavigationManager::instance().navigateBack();
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Constructs scene toggle item
+ * @param scene Scene to control
+ */
+SceneToggleItem::SceneToggleItem(IScene* scene) : _scene(scene) {}
+
+/**
+ * @brief Renders scene item with activation state
+ * @param row LCD row to draw on
+ * @param selected True if item is selected
+ */
+void SceneToggleItem::draw(uint8_t row, bool selected) {
+    char line[MENU_ITEM_COLS];
+    formatStateRow(line, selected, _scene->getName(), nullptr,
+                   _scene->isActive() ? F("ON") : F("OFF"));
+    writeRow(row, line, MENU_ITEM_COLS);
+}
+
+/**
+ * @brief Rewrites only the ON/OFF field
+ * @param row LCD row
+ * @param selected Unused
+ */
+void SceneToggleItem::drawValue(uint8_t row, bool selected) {
+    static_cast<void>(selected);
+    writeStateField(row, _scene->isActive() ? F("ON") : F("OFF"));
+}
+
+/**
+ * @brief Toggles scene activation on ENTER
+ * @param event Input event
+ * @return True if scene state changed
+ */
+bool SceneToggleItem::handleInput(InputEvent event) {
+    if (event == InputEvent::ENTER) {
+        if (_scene->isActive()) {
+            SceneManager::instance().removeScene(_scene);
+        } else {
+            SceneManager::instance().addScene(_scene);
+        }
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Constructs a page for a PROGMEM menu table
+ * @param table Table in PROGMEM
+ * @param context Device or data handed to actions and child pages
+ * @param parent Parent page
+ */
+TablePage::TablePage(const MenuTable* table, void* context, MenuPage* parent)
+    : MenuPage(reinterpret_cast<const __FlashStringHelper*>(pgm_read_ptr(&table->title)), parent),
+      _table(table), _context(context) {}
+
+/**
+ * @brief Copies one entry from PROGMEM into RAM
+ * @param index Entry index
+ * @param entry Destination
+ */
+void TablePage::readEntry(size_t index, MenuEntry& entry) const {
+    const MenuEntry* entries = static_cast<const MenuEntry*>(pgm_read_ptr(&_table->entries));
+    memcpy_P(&entry, &entries[index], sizeof(MenuEntry));
+}
+
+/**
+ * @brief Gets the number of rows in the table
+ * @return Entry count
+ */
+size_t TablePage::getItemsCount() const {
+    return pgm_read_byte(&_table->count);
+}
+
+/**
+ * @brief Table rows are always one line high
+ * @param index Entry index
+ * @return 1
+ */
+uint8_t TablePage::getRowHeight(size_t index) const {
+    static_cast<void>(index);
+    return 1;
+}
+
+/**
+ * @brief Renders a table row in the same layout as the item classes
+ * @param index Entry index
+ * @param row LCD row
+ * @param selected True if entry is selected
+ */
+void TablePage::drawRow(size_t index, uint8_t row, bool selected) {
+    MenuEntry entry;
+    readEntry(index, entry);
+
+    char line[MENU_ITEM_COLS];
+    putCursor(line, selected);
+    if (entry.kind == MenuEntryKind::TABLE || entry.kind == MenuEntryKind::PAGE) {
+        TextFormat::putLabel(line + 2, MENU_ITEM_COLS - 4, reinterpret_cast<const __FlashStringHelper*>(entry.label));
+        line[MENU_ITEM_COLS - 2] = ' ';
+        line[MENU_ITEM_COLS - 1] = '>';
+    } else if (entry.kind == MenuEntryKind::BACK) {
+        TextFormat::putLabel(line + 2, MENU_ITEM_COLS - 2, F("<< Back"));
+    } else {
+        TextFormat::putLabel(line + 2, MENU_ITEM_COLS - 2, reinterpret_cast<const __FlashStringHelper*>(entry.label));
+    }
+    writeRow(row, line, MENU_ITEM_COLS);
+}
+
+/**
+ * @brief Gets the label field of a table row
+ * @param index Row index
+ * @param col Receives the first column of the label field
+ * @param width Receives the field width in cells
+ * @return Row label, or nullptr for the Back row
+ */
+const __FlashStringHelper* TablePage::getRowLabel(size_t index, uint8_t& col, uint8_t& width) {
+    MenuEntry entry;
+    readEntry(index, entry);
+    if (entry.kind == MenuEntryKind::BACK) return nullptr;
+
+    col = 2;
+    bool arrow = entry.kind == MenuEntryKind::TABLE || entry.kind == MenuEntryKind::PAGE;
+    width = arrow ? MENU_ITEM_COLS - 4 : MENU_ITEM_COLS - 2;
+    return reinterpret_cast<const __FlashStringHelper*>(entry.label);
+}
+
+/**
+ * @brief Table rows only react to ENTER, so just move the cursor
+ * @param event Input event
+ * @return True if event was handled
+ */
+bool TablePage::handleInput(InputEvent event) {
+    return moveCursor(event);
+}
+
+/**
+ * @brief Runs the selected entry
+ * @return Child page to push, or nullptr
+ */
+MenuPage* TablePage::handleEnter() {
+    if (_selected_index >= getItemsCount()) return nullptr;
+
+    MenuEntry entry;
+    readEntry(_selected_index, entry);
+
+    switch (entry.kind) {
+        case MenuEntryKind::ACTION:
+            entry.action(static_cast<IDevice*>(_context), entry.param);
+            NavigationManager::instance().navigateBack();
+            return nullptr;
+        case MenuEntryKind::TABLE:
+            return new TablePage(entry.child, _context, this);
+        case MenuEntryKind::PAGE:
+            return PageCache::instance().open(entry.builder, _context);
+        case MenuEntryKind::BACK:
+            NavigationManager::instance().navigateBack();
+            return nullptr;
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Builds ahead the page behind a PAGE row under the cursor
+ * @details TABLE rows are skipped: a TablePage costs only a few bytes and
+ * nothing is scanned to create it.
+ */
+void TablePage::prefetchSelected() {
+    if (_selected_index >= getItemsCount()) return;
+
+    MenuEntry entry;
+    readEntry(_selected_index, entry);
+    if (entry.kind == MenuEntryKind::PAGE) {
+        PageCache::instance().prefetch(entry.builder, _context);
+    }
+}
+
+/**
+ * @brief Constructs a generated device list
+ * @param title Flash string title
+ * @param generator Row generator
+ * @param parent Parent page
+ * @details The registry is fixed after setup(), so the row count is taken
+ * once here. The registry cursor starts on the first listed device.
+ */
+DeviceListPage::DeviceListPage(const __FlashStringHelper* title, RowGenerator generator,
+                               MenuPage* parent)
+    : MenuPage(title, parent), _generator(generator), _count(0), _cursorRow(0),
+      _cursorDevice(0), _rowItem(nullptr), _inputItem(nullptr) {
+    const DynamicArray<IDevice*>& devices = DeviceRegistry::instance().getDevices();
+    for (uint8_t i = 0; i < devices.size(); i++) {
+        if (!lists(devices[i], _row)) continue;
+        if (_count == 0) _cursorDevice = i;
+        _count++;
+    }
+}
+
+/**
+ * @brief Destroys the rows still held in the slots
+ */
+DeviceListPage::~DeviceListPage() {
+    if (_rowItem) _rowItem->~MenuItem();
+    if (_inputItem) _inputItem->~MenuItem();
+}
+
+/**
+ * @brief Checks if the generator lists a device
+ * @param device Device from DeviceRegistry
+ * @param slot Scratch slot, left empty
+ * @return True if the device has a row
+ */
+bool DeviceListPage::lists(IDevice* device, uint8_t* slot) const {
+    MenuItem* probe = _generator(device, slot);
+    if (!probe) return false;
+    probe->~MenuItem();
+    return true;
+}
+
+/**
+ * @brief Gets the number of rows, Back included
+ * @return Row count
+ */
+size_t DeviceListPage::getItemsCount() const {
+    return _count + 1;
+}
+
+/**
+ * @brief Every generated row is one LCD line
+ * @param index Row index
+ * @return 1
+ */
+uint8_t DeviceListPage::getRowHeight(size_t index) const {
+    static_cast<void>(index);
+    return 1;
+}
+
+/**
+ * @brief Builds a row into a slot, destroying the slot's previous item
+ * @param index Row index
+ * @param slot Row storage
+ * @param live Item currently in slot; receives the new one
+ * @return Row item, or nullptr if out of range
+ * @details The registry cursor is stepped from the last row found, one
+ * device at a time, in whichever direction the requested row lies.
+ */
+MenuItem* DeviceListPage::buildRow(size_t index, uint8_t* slot, MenuItem*& live) {
+    if (live) live->~MenuItem();
+    live = nullptr;
+    if (index == _count) return live = new (slot) BackMenuItem();
+    if (index > _count) return nullptr;
+
+    const DynamicArray<IDevice*>& devices = DeviceRegistry::instance().getDevices();
+    while (_cursorRow < index) {
+        if (lists(devices[++_cursorDevice], slot)) _cursorRow++;
+    }
+    while (_cursorRow > index) {
+        if (lists(devices[--_cursorDevice], slot)) _cursorRow--;
+    }
+    return live = _generator(devices[_cursorDevice], slot);
+}
+
+/**
+ * @brief Builds the row at an index into the transient slot
+ * @param index Row index
+ * @return Row item (valid until the next call), or nullptr if out of range
+ */
+MenuItem* DeviceListPage::itemAt(size_t index) {
+    return buildRow(index, _row, _rowItem);
+}
+
+/**
+ * @brief Builds the selected row into the input slot
+ * @return Row item (valid until the next input), or nullptr
+ */
+MenuItem* DeviceListPage::inputItem() {
+    return buildRow(_selected_index, _input, _inputItem);
+}
+
+/**
+ * @brief Big numeral positions on the home screen: {column, top row}
+ * @details Entries 0-3 are the HH:MM digits, 4-6 the temperature digits.
+ */
+static const uint8_t HOME_DIGITS[7][2] PROGMEM = {
+    {0, 0}, {4, 0}, {8, 0}, {12, 0},
+    {0, 2}, {4, 2}, {8, 2}
+};
+static constexpr uint8_t HOME_POINT_CELL = 7;   ///< Index of the decimal point in the cell array
+static constexpr uint8_t HOME_POINT_COL = 7;    ///< Decimal point column (row 3)
+static constexpr char HOME_COLON = static_cast<char>(0xA5);  ///< ROM middle dot
+
+/**
+ * @brief Constructs the home page and loads the segment glyphs
+ * @param sensor Temperature sensor to display (nullptr shows "--")
+ * @param parent Page returned to with BACK
+ */
+HomePage::HomePage(TemperatureSensor* sensor, MenuPage* parent)
+    : MenuPage(F("Home"), parent), _sensor(sensor), _nextMinute(0) {
+    _shown[0] = '\0';
+}
+
+/**
+ * @brief Swallows UP/DOWN; BACK and ENTER are left to NavigationManager
+ * @param event Input event
+ * @return True if event was handled
+ */
+bool HomePage::handleInput(InputEvent event) {
+    return event == InputEvent::UP || event == InputEvent::DOWN;
+}
+
+/**
+ * @brief Schedules a redraw when the displayed sensor reports
+ * @param type Event type received
+ * @param device Device that triggered the event
+ * @param value Event-specific value
+ */
+void HomePage::handleEvent(EventType type, IDevice* device, int value) {
+    static_cast<void>(type);
+    static_cast<void>(value);
+    if (device == _sensor) {
+        _needs_redraw = true;
+    }
+}
+
+/**
+ * @brief Invalidates the digit cache so the next render repaints everything
+ */
+void HomePage::forceRedraw() {
+    _shown[0] = '\0';
+    MenuPage::forceRedraw();
+}
+
+/**
+ * @brief Frees the segment glyphs while another page is shown
+ * @details render() takes them back when the home page is on top again.
  */
-void LightCalibrationItem::draw(uint8_t row, bool selected) {
-    LCD_set_cursor(0, row);
-    LCD_write_str(selected ? "> " : "  ");
-    printLabel(_label);
+void HomePage::onCovered() {
+    _big.release();
 }
 
 /**
- * @brief Handles calibration action on ENTER
- * @param event Input event
- * @return True if calibration was performed
+ * @brief Keeps the home page out of PageCache
+ * @return Always false: the big digits hold seven of the eight CGRAM slots
  */
-bool LightCalibrationItem::handleInput(InputEvent event) {
-    if (event == InputEvent::ENTER) {
-        if (_isDark) {
-            _sensor->calibrateCurrentAsMin();
-        } else {
-            _sensor->calibrateCurrentAsMax();
-        }
-        _sensor->getStats().reset();
-        EventSystem::instance().emit(EventType::SensorUpdated, _sensor, _sensor->getValue());
-        return true;
-    }
+bool HomePage::isCacheable() const {
     return false;
 }
 
 /**
- * @brief Constructs action item with callback
- * @param label Display label
- * @param device Target device for action
- * @param action Function pointer to execute
- * @param param Parameter to pass to action
+ * @brief Requests a redraw when the uptime clock reaches the next minute
  */
-ActionItem::ActionItem(const __FlashStringHelper* label, IDevice* device, void (*action)(IDevice*, int), int param)
-    : _device(device), _label(label), _action(action), _param(param) {}
+void HomePage::tick() {
+    if (static_cast<long>(millis() - _nextMinute) >= 0) {
+        _needs_redraw = true;
+    }
+}
 
 /**
- * @brief Renders action item
- * @param row LCD row to draw on
- * @param selected True if item is selected
- */
-void ActionItem::draw(uint8_t row, bool selected) {
-    LCD_set_cursor(0, row);
-    LCD_write_str(selected ? "> " : "  ");
-    printLabel(_label);
+ * @brief Computes the character shown in every cell
+ * @param cells Output: HH, MM, temperature digits, decimal point
+ * @details Temperatures from -9.9 to 99.9 keep one decimal; outside that
+ * range the value is shown as a whole number without the point.
+ */
+void HomePage::composeCells(char* cells) const {
+    unsigned long minutes = millis() / MINUTE_MS;
+    uint8_t hh = (minutes / 60) % 24;
+    uint8_t mm = minutes % 60;
+    cells[0] = static_cast<char>('0' + hh / 10);
+    cells[1] = static_cast<char>('0' + hh % 10);
+    cells[2] = static_cast<char>('0' + mm / 10);
+    cells[3] = static_cast<char>('0' + mm % 10);
+
+    char text[4];
+    cells[HOME_POINT_CELL] = ' ';
+    if (!_sensor) {
+        cells[4] = ' ';
+        cells[5] = '-';
+        cells[6] = '-';
+        return;
+    }
+
+    int16_t deci = _sensor->getTemperature();
+    if (deci > -100 && deci < 1000) {
+        TextFormat::putDeci(text, 4, deci);
+        cells[4] = text[0];
+        cells[5] = text[1];
+        cells[6] = text[3];
+        cells[HOME_POINT_CELL] = '.';
+    } else {
+        TextFormat::putInt(text, 3, deci / 10);
+        cells[4] = text[0];
+        cells[5] = text[1];
+        cells[6] = text[2];
+    }
 }
 
 /**
- * @brief Executes action and navigates back on ENTER
- * @param event Input event
- * @return True if action was executed
+ * @brief Draws the home screen, touching only numerals that changed
+ * @details A full render writes the four rows once. Afterwards each changed
+ * numeral costs 6 cells, so a minute tick usually rewrites a single digit
+ * instead of 80 characters.
  */
-bool ActionItem::handleInput(InputEvent event) {
-    if (event == InputEvent::ENTER) {
-        _action(_device, _param);
-        NavigationManager::instance().navigateBack();
-        return true;
+void HomePage::render() {
+    char cells[CELL_COUNT];
+    composeCells(cells);
+    _nextMinute = (millis() / MINUTE_MS + 1) * MINUTE_MS;
+
+    if (!_big.isReady() && !_big.acquire()) {
+        renderText(cells);
+        return;
     }
-    return false;
+
+    if (_shown[0] == '\0') {
+        char top[LCD_COLS];
+        char bottom[LCD_COLS];
+        for (uint8_t band = 0; band < 2; band++) {
+            TextFormat::fill(top, LCD_COLS);
+            TextFormat::fill(bottom, LCD_COLS);
+            for (uint8_t i = 0; i < HOME_POINT_CELL; i++) {
+                uint8_t col = pgm_read_byte(&HOME_DIGITS[i][0]);
+                uint8_t row = pgm_read_byte(&HOME_DIGITS[i][1]);
+                if (row == band * 2) _big.compose(top + col, bottom + col, cells[i]);
+            }
+            if (band == 0) {
+                top[7] = HOME_COLON;
+                bottom[7] = HOME_COLON;
+                TextFormat::putLabel(bottom + 16, 4, F("up"));
+            } else {
+                top[11] = static_cast<char>(0xDF);
+                top[12] = 'C';
+                bottom[HOME_POINT_COL] = cells[HOME_POINT_CELL];
+                TextFormat::putLabel(bottom + 13, 7, F("Outside"));
+            }
+            IDisplay::instance().setCursor(0, band * 2);
+            IDisplay::instance().write(top, LCD_COLS);
+            IDisplay::instance().setCursor(0, band * 2 + 1);
+            IDisplay::instance().write(bottom, LCD_COLS);
+        }
+    } else {
+        for (uint8_t i = 0; i < HOME_POINT_CELL; i++) {
+            if (cells[i] != _shown[i]) {
+                _big.draw(pgm_read_byte(&HOME_DIGITS[i][0]), pgm_read_byte(&HOME_DIGITS[i][1]), cells[i]);
+            }
+        }
+        if (cells[HOME_POINT_CELL] != _shown[HOME_POINT_CELL]) {
+            IDisplay::instance().setCursor(HOME_POINT_COL, 3);
+            IDisplay::instance().writeChar(cells[HOME_POINT_CELL]);
+        }
+    }
+    memcpy(_shown, cells, CELL_COUNT);
 }
 
 /**
- * @brief Constructs submenu item with JIT page builder
- * @param label Display label
- * @param builder Function that creates the submenu page
- * @param context Context data passed to builder
+ * @brief Repaints the home screen after rows were covered
+ * @param rows Covered rows (unused)
+ * @details Every numeral spans two rows, so the next update repaints the
+ * whole screen instead.
  */
-SubMenuItem::SubMenuItem(const __FlashStringHelper* label, PageBuilder builder, void* context)
-    : _label(label), _builder(builder), _context(context) {}
+void HomePage::renderRows(uint8_t rows) {
+    static_cast<void>(rows);
+    forceRedraw();
+}
 
 /**
- * @brief Returns item type for polymorphic dispatch
- * @return MenuItemType::SUBMENU
- */
-MenuItemType SubMenuItem::getType() const { 
-    return MenuItemType::SUBMENU; 
+ * @brief Plain text fallback when the segment glyphs are unavailable
+ * @param cells Characters from composeCells()
+ */
+void HomePage::renderText(const char* cells) {
+    char line[LCD_COLS];
+    for (uint8_t row = 0; row < LCD_ROWS; row++) {
+        TextFormat::fill(line, LCD_COLS);
+        if (row == 0) {
+            TextFormat::putLabel(line, 10, F("Uptime"));
+            line[10] = cells[0];
+            line[11] = cells[1];
+            line[12] = ':';
+            line[13] = cells[2];
+            line[14] = cells[3];
+        } else if (row == 2) {
+            TextFormat::putLabel(line, 10, F("Outside"));
+            line[10] = cells[4];
+            line[11] = cells[5];
+            line[12] = cells[HOME_POINT_CELL];
+            line[13] = cells[6];
+            line[14] = static_cast<char>(0xDF);
+            line[15] = 'C';
+        }
+        IDisplay::instance().setCursor(0, row);
+        IDisplay::instance().write(line, LCD_COLS);
+    }
 }
 
 /**
- * @brief Creates submenu page using JIT builder
- * @return Heap-allocated menu page
+ * @brief Constructs the dashboard and resolves each tile's device
+ * @param tiles Tile table (PROGMEM)
+ * @param count Number of tiles (capped at MAX_TILES)
+ * @param parent Page returned to with BACK
+ */
+DashboardPage::DashboardPage(const DashboardTile* tiles, uint8_t count, MenuPage* parent)
+    : MenuPage(F("Dashboard"), parent), _tiles(tiles),
+      _count(count < MAX_TILES ? count : MAX_TILES), _due(0), _full(true) {
+    const DynamicArray<IDevice*>& devices = DeviceRegistry::instance().getDevices();
+    unsigned long now = millis();
+    for (uint8_t i = 0; i < _count; i++) {
+        DashboardTile tile;
+        readTile(i, tile);
+        _sources[i] = nullptr;
+        for (size_t d = 0; tile.source != DeviceType::Unknown && d < devices.size(); d++) {
+            if (devices[d]->type == tile.source) {
+                _sources[i] = devices[d];
+                break;
+            }
+        }
+        _shown[i] = UNKNOWN;
+        _next[i] = now;
+    }
+}
+
+/**
+ * @brief Copies one tile descriptor out of flash
+ * @param index Tile index
+ * @param tile Output descriptor
  */
-MenuPage* SubMenuItem::createPage() const { 
-    return _builder(_context); 
+void DashboardPage::readTile(uint8_t index, DashboardTile& tile) const {
+    memcpy_P(&tile, &_tiles[index], sizeof(DashboardTile));
 }
 
 /**
- * @brief Renders submenu item with arrow indicator
- * @param row LCD row to draw on
- * @param selected True if item is selected
+ * @brief Reads the current value of a tile
+ * @param index Tile index
+ * @param tile Tile descriptor
+ * @return Value, or UNKNOWN when the tile device is missing
  */
-void SubMenuItem::draw(uint8_t row, bool selected) {
-    LCD_set_cursor(0, row);
-    LCD_write_str(selected ? "> " : "  ");
-    printLabel(_label);
-    LCD_write_str(" >");
+int16_t DashboardPage::readValue(uint8_t index, const DashboardTile& tile) const {
+    if (tile.source != DeviceType::Unknown && !_sources[index]) return UNKNOWN;
+    return tile.read(_sources[index]);
 }
 
 /**
- * @brief Handles submenu navigation on ENTER
- * @param event Input event
- * @return True if navigation occurred
+ * @brief Formats a tile value into its VALUE_WIDTH cells
+ * @param cells Output buffer
+ * @param tile Tile descriptor
+ * @param value Value from readValue(); UNKNOWN shows "--"
  */
-bool SubMenuItem::handleInput(InputEvent event) {
-    if (event == InputEvent::ENTER) {
-        MenuPage* newPage = createPage();
-        NavigationManager::instance().pushPage(newPage);
-        return true;
+void DashboardPage::putValue(char* cells, const DashboardTile& tile, int16_t value) {
+    if (value == UNKNOWN) {
+        TextFormat::fill(cells, VALUE_WIDTH);
+        cells[VALUE_WIDTH - 2] = '-';
+        cells[VALUE_WIDTH - 1] = '-';
+    } else if (tile.tenths) {
+        TextFormat::putDeci(cells, VALUE_WIDTH, value);
+    } else {
+        TextFormat::putInt(cells, VALUE_WIDTH, value);
     }
-    return false;
 }
 
 /**
- * @brief Constructs back navigation item
+ * @brief Swallows UP/DOWN; BACK is left to NavigationManager
+ * @param event Input event
+ * @return True if event was handled
  */
-BackMenuItem::BackMenuItem() {}
+bool DashboardPage::handleInput(InputEvent event) {
+    return event == InputEvent::UP || event == InputEvent::DOWN;
+}
 
 /**
- * @brief Renders back item
- * @param row LCD row to draw on
- * @param selected True if item is selected
+ * @brief Ignores device events: tiles refresh on their own period
+ * @param type Event type received
+ * @param device Device that triggered the event
+ * @param value Event-specific value
  */
-void BackMenuItem::draw(uint8_t row, bool selected) {
-    LCD_set_cursor(0, row);
-    LCD_write_str(selected ? "> " : "  ");
-    LCD_write_str("<< Back");
+void DashboardPage::handleEvent(EventType type, IDevice* device, int value) {
+    static_cast<void>(type);
+    static_cast<void>(device);
+    static_cast<void>(value);
 }
 
 /**
- * @brief Handles back navigation on ENTER
- * @param event Input event
- * @return True if navigation occurred
+ * @brief Repaints every tile on the next render
  */
-bool BackMenuItem::handleInput(InputEvent event) {
-    if (event == InputEvent::ENTER) {
-        NavigationManager::instance().navigateBack();
-        return true;
-    }
-    return false;
+void DashboardPage::forceRedraw() {
+    _full = true;
+    MenuPage::forceRedraw();
 }
 
 /**
- * @brief Constructs scene toggle item
- * @param scene Scene to control
+ * @brief Marks the tiles whose refresh period elapsed
  */
-SceneToggleItem::SceneToggleItem(IScene* scene) : _scene(scene) {}
+void DashboardPage::tick() {
+    unsigned long now = millis();
+    for (uint8_t i = 0; i < _count; i++) {
+        if (static_cast<long>(now - _next[i]) < 0) continue;
+        DashboardTile tile;
+        readTile(i, tile);
+        _next[i] = now + tile.periodMs;
+        _due |= static_cast<uint8_t>(1 << i);
+    }
+    if (_due) _needs_redraw = true;
+}
 
 /**
- * @brief Renders scene item with activation state
- * @param row LCD row to draw on
- * @param selected True if item is selected
+ * @brief Draws the dashboard, touching only the value cells that changed
+ * @details A full render composes and writes the four rows once. Afterwards
+ * only due tiles are read, and a tile whose value is unchanged costs no LCD
+ * traffic at all.
  */
-void SceneToggleItem::draw(uint8_t row, bool selected) {
-    LCD_set_cursor(0, row);
-    LCD_write_str(selected ? "> " : "  ");
-    LCD_write_str(_scene->getName());
-    LCD_set_cursor(15, row);
-    LCD_write_str(_scene->isActive() ? "ON " : "OFF");
+void DashboardPage::render() {
+    DashboardTile tile;
+    if (_full) {
+        renderRows(ALL_ROWS);
+        _full = false;
+        _due = 0;
+        return;
+    }
+
+    for (uint8_t i = 0; i < _count; i++) {
+        if (!(_due & (1 << i))) continue;
+        readTile(i, tile);
+        int16_t value = readValue(i, tile);
+        if (value == _shown[i] || tile.col + tile.width > LCD_COLS) continue;
+        _shown[i] = value;
+        char cells[VALUE_WIDTH];
+        putValue(cells, tile, value);
+        IDisplay::instance().setCursor(tile.col + tile.width - strlen_P(tile.unit) - VALUE_WIDTH, tile.row);
+        IDisplay::instance().write(cells, VALUE_WIDTH);
+    }
+    _due = 0;
 }
 
 /**
- * @brief Toggles scene activation on ENTER
- * @param event Input event
- * @return True if scene state changed
- */
-bool SceneToggleItem::handleInput(InputEvent event) {
-    if (event == InputEvent::ENTER) {
-        if (_scene->isActive()) {
-            SceneManager::instance().removeScene(_scene);
-        } else {
-            SceneManager::instance().addScene(_scene);
+ * @brief Composes and writes whole rows: labels, current values and units
+ * @param rows Bit r set = repaint LCD row r
+ */
+void DashboardPage::renderRows(uint8_t rows) {
+    DashboardTile tile;
+    char line[LCD_COLS];
+    for (uint8_t row = 0; row < LCD_ROWS; row++) {
+        if (!(rows & (1 << row))) continue;
+        TextFormat::fill(line, LCD_COLS);
+        for (uint8_t i = 0; i < _count; i++) {
+            readTile(i, tile);
+            if (tile.row != row || tile.col + tile.width > LCD_COLS) continue;
+            uint8_t unitLen = strlen_P(tile.unit);
+            uint8_t valueCol = tile.col + tile.width - unitLen - VALUE_WIDTH;
+            _shown[i] = readValue(i, tile);
+            TextFormat::putLabel(line + tile.col, valueCol - tile.col,
+                                 reinterpret_cast<const __FlashStringHelper*>(tile.label));
+            putValue(line + valueCol, tile, _shown[i]);
+            TextFormat::putLabel(line + valueCol + VALUE_WIDTH, unitLen,
+                                 reinterpret_cast<const __FlashStringHelper*>(tile.unit));
         }
-        return true;
+        IDisplay::instance().setCursor(0, row);
+        IDisplay::instance().write(line, LCD_COLS);
     }
-    return false;
 }
 
 /**
@@ -663,6 +2200,94 @@ void MenuBuilder::setRGBPresetAction(IDevice* d, int v) {
     static_cast<RGBLight*>(d)->setPreset(static_cast<RGBPreset>(v));
 }
 
+// ==================== Static menu tables (PROGMEM) ====================
+
+static const char STR_SET_RED[] PROGMEM = "Set Red";
+static const char STR_SET_GREEN[] PROGMEM = "Set Green";
+static const char STR_SET_BLUE[] PROGMEM = "Set Blue";
+static const char STR_WARM_WHITE[] PROGMEM = "Warm White";
+static const char STR_COOL_WHITE[] PROGMEM = "Cool White";
+static const char STR_RED[] PROGMEM = "Red";
+static const char STR_GREEN[] PROGMEM = "Green";
+static const char STR_BLUE[] PROGMEM = "Blue";
+static const char STR_OCEAN[] PROGMEM = "Ocean";
+static const char STR_OFF[] PROGMEM = "OFF";
+static const char STR_ON[] PROGMEM = "ON";
+static const char STR_AUTO_LIGHT[] PROGMEM = "AUTO LIGHT";
+static const char STR_AUTO_MOTION[] PROGMEM = "AUTO MOTION";
+static const char STR_SET_MODE[] PROGMEM = "Set Mode";
+static const char STR_HOME_SCREEN[] PROGMEM = "Home Screen";
+static const char STR_LIGHTS[] PROGMEM = "Lights";
+static const char STR_SENSORS[] PROGMEM = "Sensors";
+static const char STR_SCENES[] PROGMEM = "Scenes";
+static const char STR_DASHBOARD[] PROGMEM = "Dashboard";
+
+static const char STR_CUSTOM_COLOR_TITLE[] PROGMEM = "Custom Color";
+static const char STR_SELECT_PRESET_TITLE[] PROGMEM = "Select Preset";
+static const char STR_SELECT_MODE_TITLE[] PROGMEM = "Select Mode";
+static const char STR_OUTSIDE_LIGHT_TITLE[] PROGMEM = "Outside Light";
+static const char STR_MAIN_MENU_TITLE[] PROGMEM = "Main Menu";
+
+#define MENU_ACTION(label, fn, value) {label, MenuEntryKind::ACTION, fn, static_cast<int16_t>(value), nullptr, nullptr}
+#define MENU_TABLE(label, table)      {label, MenuEntryKind::TABLE, nullptr, 0, &table, nullptr}
+#define MENU_PAGE(label, builder)     {label, MenuEntryKind::PAGE, nullptr, 0, nullptr, builder}
+#define MENU_BACK                     {nullptr, MenuEntryKind::BACK, nullptr, 0, nullptr, nullptr}
+#define MENU_COUNT(entries)           static_cast<uint8_t>(sizeof(entries) / sizeof(MenuEntry))
+
+const MenuEntry MenuBuilder::CUSTOM_COLOR_ENTRIES[] PROGMEM = {
+    MENU_PAGE(STR_SET_RED, buildRedPage),
+    MENU_PAGE(STR_SET_GREEN, buildGreenPage),
+    MENU_PAGE(STR_SET_BLUE, buildBluePage),
+    MENU_BACK
+};
+
+const MenuEntry MenuBuilder::RGB_PRESET_ENTRIES[] PROGMEM = {
+    MENU_ACTION(STR_WARM_WHITE, setRGBPresetAction, RGBPreset::WARM_WHITE),
+    MENU_ACTION(STR_COOL_WHITE, setRGBPresetAction, RGBPreset::COOL_WHITE),
+    MENU_ACTION(STR_RED, setRGBPresetAction, RGBPreset::RED),
+    MENU_ACTION(STR_GREEN, setRGBPresetAction, RGBPreset::GREEN),
+    MENU_ACTION(STR_BLUE, setRGBPresetAction, RGBPreset::BLUE),
+    MENU_ACTION(STR_OCEAN, setRGBPresetAction, RGBPreset::OCEAN),
+    MENU_BACK
+};
+
+const MenuEntry MenuBuilder::OUTSIDE_MODE_ENTRIES[] PROGMEM = {
+    MENU_ACTION(STR_OFF, setOutsideModeAction, OutsideMode::OFF),
+    MENU_ACTION(STR_ON, setOutsideModeAction, OutsideMode::ON),
+    MENU_ACTION(STR_AUTO_LIGHT, setOutsideModeAction, OutsideMode::AUTO_LIGHT),
+    MENU_ACTION(STR_AUTO_MOTION, setOutsideModeAction, OutsideMode::AUTO_MOTION),
+    MENU_BACK
+};
+
+const MenuEntry MenuBuilder::OUTSIDE_LIGHT_ENTRIES[] PROGMEM = {
+    MENU_TABLE(STR_SET_MODE, OUTSIDE_MODES_MENU),
+    MENU_BACK
+};
+
+const MenuEntry MenuBuilder::MAIN_MENU_ENTRIES[] PROGMEM = {
+    MENU_PAGE(STR_HOME_SCREEN, buildHomePage),
+    MENU_PAGE(STR_DASHBOARD, buildDashboardPage),
+    MENU_PAGE(STR_LIGHTS, buildLightsPage),
+    MENU_PAGE(STR_SENSORS, buildSensorsPage),
+    MENU_PAGE(STR_SCENES, buildScenesPage)
+};
+
+const MenuTable MenuBuilder::CUSTOM_COLOR_MENU PROGMEM = {
+    STR_CUSTOM_COLOR_TITLE, CUSTOM_COLOR_ENTRIES, MENU_COUNT(CUSTOM_COLOR_ENTRIES)
+};
+const MenuTable MenuBuilder::RGB_PRESETS_MENU PROGMEM = {
+    STR_SELECT_PRESET_TITLE, RGB_PRESET_ENTRIES, MENU_COUNT(RGB_PRESET_ENTRIES)
+};
+const MenuTable MenuBuilder::OUTSIDE_MODES_MENU PROGMEM = {
+    STR_SELECT_MODE_TITLE, OUTSIDE_MODE_ENTRIES, MENU_COUNT(OUTSIDE_MODE_ENTRIES)
+};
+const MenuTable MenuBuilder::OUTSIDE_LIGHT_MENU PROGMEM = {
+    STR_OUTSIDE_LIGHT_TITLE, OUTSIDE_LIGHT_ENTRIES, MENU_COUNT(OUTSIDE_LIGHT_ENTRIES)
+};
+const MenuTable MenuBuilder::MAIN_MENU PROGMEM = {
+    STR_MAIN_MENU_TITLE, MAIN_MENU_ENTRIES, MENU_COUNT(MAIN_MENU_ENTRIES)
+};
+
 /**
  * @brief Builds red channel adjustment page
  * @param context RGBLight pointer
@@ -728,16 +2353,7 @@ MenuPage* MenuBuilder::buildBrightnessPage(void* context) {
  * @return Heap-allocated menu page
  */
 MenuPage* MenuBuilder::buildCustomColorPage(void* context) {
-    RGBLight* light = static_cast<RGBLight*>(context);
-    MenuPage* page = new MenuPage(F("Custom Color"), nullptr);
-    if (!page) return nullptr;
-
-    page->addItem(new SubMenuItem(F("Set Red"), buildRedPage, light));
-    page->addItem(new SubMenuItem(F("Set Green"), buildGreenPage, light));
-    page->addItem(new SubMenuItem(F("Set Blue"), buildBluePage, light));
-    page->addItem(new BackMenuItem());
-
-    return page;
+    return new TablePage(&CUSTOM_COLOR_MENU, context, NavigationManager::instance().getCurrentPage());
 }
 
 /**
@@ -746,18 +2362,7 @@ MenuPage* MenuBuilder::buildCustomColorPage(void* context) {
  * @return Heap-allocated menu page
  */
 MenuPage* MenuBuilder::buildRGBPresetsPage(void* context) {
-    RGBLight* light = static_cast<RGBLight*>(context);
-    MenuPage* page = new MenuPage(F("Select Preset"), NavigationManager::instance().getCurrentPage());
-    if (!page) return nullptr;
-
-    page->addItem(new ActionItem(F("Warm White"), light, setRGBPresetAction, static_cast<int>(RGBPreset::WARM_WHITE)));
-    page->addItem(new ActionItem(F("Cool White"), light, setRGBPresetAction, static_cast<int>(RGBPreset::COOL_WHITE)));
-    page->addItem(new ActionItem(F("Red"), light, setRGBPresetAction, static_cast<int>(RGBPreset::RED)));
-    page->addItem(new ActionItem(F("Green"), light, setRGBPresetAction, static_cast<int>(RGBPreset::GREEN)));
-    page->addItem(new ActionItem(F("Blue"), light, setRGBPresetAction, static_cast<int>(RGBPreset::BLUE)));
-    page->addItem(new ActionItem(F("Ocean"), light, setRGBPresetAction, static_cast<int>(RGBPreset::OCEAN)));
-    page->addItem(new BackMenuItem());
-    return page;
+    return new TablePage(&RGB_PRESETS_MENU, context, NavigationManager::instance().getCurrentPage());
 }
 
 /**
@@ -795,36 +2400,114 @@ MenuPage* MenuBuilder::buildDimmableLightPage(void* context) {
 }
 
 /**
- * @brief Builds outside light modes selection page
+ * @brief Builds outside light control page
  * @param context OutsideLight pointer
  * @return Heap-allocated menu page
  */
-MenuPage* MenuBuilder::buildOutsideModesPage(void* context) {
-    OutsideLight* light = static_cast<OutsideLight*>(context);
-    MenuPage* page = new MenuPage(F("Select Mode"), NavigationManager::instance().getCurrentPage());
-    if (!page) return nullptr;
+MenuPage* MenuBuilder::buildOutsideLightPage(void* context) {
+    return new TablePage(&OUTSIDE_LIGHT_MENU, context, NavigationManager::instance().getCurrentPage());
+}
 
-    page->addItem(new ActionItem(F("OFF"), light, setOutsideModeAction, static_cast<int>(OutsideMode::OFF)));
-    page->addItem(new ActionItem(F("ON"), light, setOutsideModeAction, static_cast<int>(OutsideMode::ON)));
-    page->addItem(new ActionItem(F("AUTO LIGHT"), light, setOutsideModeAction, static_cast<int>(OutsideMode::AUTO_LIGHT)));
-    page->addItem(new ActionItem(F("AUTO MOTION"), light, setOutsideModeAction, static_cast<int>(OutsideMode::AUTO_MOTION)));
-    page->addItem(new BackMenuItem());
-    return page;
+static_assert(sizeof(DeviceToggleItem) <= DeviceListPage::ROW_BYTES, "row slot too small");
+static_assert(sizeof(LivePIRItem) <= DeviceListPage::ROW_BYTES, "row slot too small");
+static_assert(sizeof(BackMenuItem) <= DeviceListPage::ROW_BYTES, "row slot too small");
+
+static const char STR_ROW_TEMPERATURE[] PROGMEM = "Temperature";
+static const char STR_ROW_LIGHT_SENSOR[] PROGMEM = "Light Sensor";
+static const char STR_ROW_FREE_RAM[] PROGMEM = "Free RAM";
+static const char STR_ROW_VCC[] PROGMEM = "VCC Voltage";
+static const char STR_ROW_LOOP_TIME[] PROGMEM = "Loop Time";
+static const char STR_ROW_LCD_TRAFFIC[] PROGMEM = "LCD Traffic";
+static const char STR_ROW_UI_LATENCY[] PROGMEM = "UI Latency";
+static const char STR_STAT_C[] PROGMEM = "C";
+static const char STR_STAT_PERCENT[] PROGMEM = "%";
+static const char STR_STAT_BYTES[] PROGMEM = "B";
+static const char STR_STAT_MV[] PROGMEM = "mV";
+static const char STR_STAT_US[] PROGMEM = "us";
+static const char STR_STAT_BPS[] PROGMEM = "B/s";
+
+#define DEVICE_NONE                    {DeviceRowKind::NONE, nullptr, nullptr, nullptr, nullptr, false}
+#define DEVICE_TOGGLE                  {DeviceRowKind::TOGGLE, nullptr, nullptr, nullptr, nullptr, false}
+#define DEVICE_PAGE(label, builder)    {DeviceRowKind::SUBMENU, label, builder, nullptr, nullptr, false}
+#define DEVICE_SENSOR(label, builder, unit, type, tenths) \
+    {DeviceRowKind::SUBMENU, label, builder, unit, statsOf<type>, tenths}
+
+/**
+ * @brief Menu description of every DeviceType, indexed by the enum value
+ */
+const DeviceMenuRow MenuBuilder::DEVICE_ROWS[] PROGMEM = {
+    DEVICE_NONE,                                                       // Unknown
+    DEVICE_TOGGLE,                                                     // LightSimple
+    DEVICE_PAGE(nullptr, buildDimmableLightPage),                      // LightDimmable
+    DEVICE_PAGE(nullptr, buildRGBLightPage),                           // LightRGB
+    DEVICE_PAGE(nullptr, buildOutsideLightPage),                       // LightOutside
+    DEVICE_SENSOR(STR_ROW_TEMPERATURE, buildSensorStatsPage, STR_STAT_C, TemperatureSensor, true),
+    DEVICE_SENSOR(STR_ROW_LIGHT_SENSOR, buildLightSettingsPage, STR_STAT_PERCENT, PhotoresistorSensor, false),
+    {DeviceRowKind::PIR, nullptr, nullptr, nullptr, nullptr, false},   // SensorPIR
+    DEVICE_SENSOR(STR_ROW_FREE_RAM, buildSensorStatsPage, STR_STAT_BYTES, RamSensorDevice, false),
+    DEVICE_SENSOR(STR_ROW_VCC, buildSensorStatsPage, STR_STAT_MV, VccSensorDevice, false),
+    DEVICE_SENSOR(STR_ROW_LOOP_TIME, buildSensorStatsPage, STR_STAT_US, LoopTimeSensorDevice, false),
+    DEVICE_SENSOR(STR_ROW_LCD_TRAFFIC, buildSensorStatsPage, STR_STAT_BPS, LcdTrafficSensorDevice, false),
+    DEVICE_PAGE(STR_ROW_UI_LATENCY, buildLatencyPage)                  // SensorUiLatency
+};
+
+/**
+ * @brief Copies the menu description of a device type out of flash
+ * @param type Device type
+ * @param row Output row
+ * @return False if the type has no row
+ */
+bool MenuBuilder::readDeviceRow(DeviceType type, DeviceMenuRow& row) {
+    static_assert(sizeof(DEVICE_ROWS) / sizeof(DeviceMenuRow) ==
+                  static_cast<uint8_t>(DeviceType::SensorUiLatency) + 1,
+                  "DEVICE_ROWS needs one row per DeviceType");
+    uint8_t index = static_cast<uint8_t>(type);
+    if (index >= sizeof(DEVICE_ROWS) / sizeof(DeviceMenuRow)) return false;
+    memcpy_P(&row, &DEVICE_ROWS[index], sizeof(DeviceMenuRow));
+    return true;
 }
 
 /**
- * @brief Builds outside light control page
- * @param context OutsideLight pointer
- * @return Heap-allocated menu page
+ * @brief Creates the list row described by DEVICE_ROWS for a device
+ * @param d Device from the registry
+ * @param storage Row slot
+ * @return Row item, nullptr if the type is not listed
+ */
+MenuItem* MenuBuilder::deviceRow(IDevice* d, void* storage) {
+    DeviceMenuRow row;
+    if (!readDeviceRow(d->type, row)) return nullptr;
+
+    switch (row.kind) {
+        case DeviceRowKind::TOGGLE:
+            return new (storage) DeviceToggleItem(d);
+        case DeviceRowKind::SUBMENU:
+            return new (storage) SubMenuItem(
+                row.label ? reinterpret_cast<const __FlashStringHelper*>(row.label) : d->name, row.builder, d);
+        case DeviceRowKind::PIR:
+            return new (storage) LivePIRItem(static_cast<PIRSensorDevice*>(d));
+        default:
+            return nullptr;
+    }
+}
+
+/**
+ * @brief Generates the Lights page row for a device
+ * @param d Device from the registry
+ * @param storage Row slot
+ * @return Toggle or submenu row, nullptr for non-light devices
  */
-MenuPage* MenuBuilder::buildOutsideLightPage(void* context) {
-    OutsideLight* light = static_cast<OutsideLight*>(context);
-    MenuPage* page = new MenuPage(F("Outside Light"), NavigationManager::instance().getCurrentPage());
-    if (!page) return nullptr;
+MenuItem* MenuBuilder::lightRow(IDevice* d, void* storage) {
+    return d->isSensor() ? nullptr : deviceRow(d, storage);
+}
 
-    page->addItem(new SubMenuItem(F("Set Mode"), buildOutsideModesPage, light));
-    page->addItem(new BackMenuItem());
-    return page;
+/**
+ * @brief Generates the Sensors page row for a device
+ * @param d Device from the registry
+ * @param storage Row slot
+ * @return Live or submenu row, nullptr for non-sensor devices
+ */
+MenuItem* MenuBuilder::sensorRow(IDevice* d, void* storage) {
+    return d->isSensor() ? deviceRow(d, storage) : nullptr;
 }
 
 /**
@@ -834,86 +2517,57 @@ MenuPage* MenuBuilder::buildOutsideLightPage(void* context) {
  */
 MenuPage* MenuBuilder::buildLightsPage(void* context) {
     static_cast<void>(context);
-    MenuPage* page = new MenuPage(F("Lights"), NavigationManager::instance().getCurrentPage());
-    if (!page) return nullptr;
-
-    DeviceRegistry& registry = DeviceRegistry::instance();
-    const DynamicArray<IDevice*>& devices = registry.getDevices();
-    
-    for (size_t i = 0; i < devices.size(); i++) {
-        IDevice* d = devices[i];
-        if (d->type == DeviceType::LightSimple) {
-            page->addItem(new DeviceToggleItem(d));
-        } else if (d->type == DeviceType::LightDimmable) {
-            page->addItem(new SubMenuItem(d->name, buildDimmableLightPage, d));
-        } else if (d->type == DeviceType::LightRGB) {
-            page->addItem(new SubMenuItem(d->name, buildRGBLightPage, d));
-        } else if (d->type == DeviceType::LightOutside) {
-            page->addItem(new SubMenuItem(d->name, buildOutsideLightPage, d));
-        }
-    }
-    page->addItem(new BackMenuItem());
-    return page;
+    return new DeviceListPage(F("Lights"), lightRow, NavigationManager::instance().getCurrentPage());
 }
 
 /**
  * @brief Builds sensor statistics page
  * @param context IDevice pointer (sensor)
  * @return Heap-allocated menu page
+ * @details Unit, formatting and statistics source come from DEVICE_ROWS.
  */
 MenuPage* MenuBuilder::buildSensorStatsPage(void* context) {
     IDevice* device = static_cast<IDevice*>(context);
     MenuPage* page = new MenuPage(F("Statistics"), NavigationManager::instance().getCurrentPage());
     if (!page) return nullptr;
-    
-    if (device->type == DeviceType::SensorTemperature) {
-        TemperatureSensor* temp = static_cast<TemperatureSensor*>(device);
-        SensorStats* stats = &temp->getStats();
-        
-        page->addItem(makeLiveItem(device, temp, &TemperatureSensor::getTemperature, F("C"), true));
-        page->addItem(makeLiveItem(F("Min"), stats, &SensorStats::getMin, F("C"), true));
-        page->addItem(makeLiveItem(F("Max"), stats, &SensorStats::getMax, F("C"), true));
-        page->addItem(makeLiveItem(F("Avg"), stats, &SensorStats::getAverage, F("C"), true));
-        
-    } else if (device->type == DeviceType::SensorLight) {
-        PhotoresistorSensor* light = static_cast<PhotoresistorSensor*>(device);
-        SensorStats* stats = &light->getStats();
-        
-        page->addItem(makeLiveItem(device, light, 
-            static_cast<int16_t (PhotoresistorSensor::*)() const>(&PhotoresistorSensor::getValue), 
-            F("%"), false));
-        page->addItem(makeLiveItem(F("Min"), stats, &SensorStats::getMin, F("%"), false));
-        page->addItem(makeLiveItem(F("Max"), stats, &SensorStats::getMax, F("%"), false));
-        page->addItem(makeLiveItem(F("Avg"), stats, &SensorStats::getAverage, F("%"), false));
-        
-    } else if (device->type == DeviceType::SensorRAM) {
-        RamSensorDevice* ram = static_cast<RamSensorDevice*>(device);
-        SensorStats* stats = &ram->getStats();
-        
-        page->addItem(makeLiveItem(device, ram, &RamSensorDevice::getValue, F("B"), false));
-        page->addItem(makeLiveItem(F("Min"), stats, &SensorStats::getMin, F("B"), false));
-        page->addItem(makeLiveItem(F("Max"), stats, &SensorStats::getMax, F("B"), false));
-        page->addItem(makeLiveItem(F("Avg"), stats, &SensorStats::getAverage, F("B"), false));
-        
-    } else if (device->type == DeviceType::SensorVCC) {
-        VccSensorDevice* vcc = static_cast<VccSensorDevice*>(device);
-        SensorStats* stats = &vcc->getStats();
-        
-        page->addItem(makeLiveItem(device, vcc, &VccSensorDevice::getValue, F("mV"), false));
-        page->addItem(makeLiveItem(F("Min"), stats, &SensorStats::getMin, F("mV"), false));
-        page->addItem(makeLiveItem(F("Max"), stats, &SensorStats::getMax, F("mV"), false));
-        page->addItem(makeLiveItem(F("Avg"), stats, &SensorStats::getAverage, F("mV"), false));
-        
-    } else if (device->type == DeviceType::SensorLoopTime) {
-        LoopTimeSensorDevice* loopSensor = static_cast<LoopTimeSensorDevice*>(device);
-        SensorStats* stats = &loopSensor->getStats();
-        
-        page->addItem(makeLiveItem(device, loopSensor, &LoopTimeSensorDevice::getValue, F("us"), false));
-        page->addItem(makeLiveItem(F("Min"), stats, &SensorStats::getMin, F("us"), false));
-        page->addItem(makeLiveItem(F("Max"), stats, &SensorStats::getMax, F("us"), false));
-        page->addItem(makeLiveItem(F("Avg"), stats, &SensorStats::getAverage, F("us"), false));
+
+    DeviceMenuRow row;
+    if (readDeviceRow(device->type, row) && row.unit) {
+        SensorStats* stats = &row.stats(device);
+        const __FlashStringHelper* unit = reinterpret_cast<const __FlashStringHelper*>(row.unit);
+
+        page->addItem(makeLiveItem(device, stats, &SensorStats::getLast, unit, row.tenths));
+        page->addItem(makeLiveItem(F("Min"), stats, &SensorStats::getMin, unit, row.tenths, device));
+        page->addItem(makeLiveItem(F("Max"), stats, &SensorStats::getMax, unit, row.tenths, device));
+        page->addItem(makeLiveItem(F("Avg"), stats, &SensorStats::getAverage, unit, row.tenths, device));
     }
-    
+
+    page->addItem(new BackMenuItem());
+    return page;
+}
+
+/**
+ * @brief Builds the UI latency page: summary then per-page breakdown
+ * @param context UiLatencySensorDevice pointer
+ * @return Heap-allocated menu page
+ */
+MenuPage* MenuBuilder::buildLatencyPage(void* context) {
+    UiLatencySensorDevice* latency = static_cast<UiLatencySensorDevice*>(context);
+    MenuPage* page = new MenuPage(F("UI Latency"), NavigationManager::instance().getCurrentPage());
+    if (!page) return nullptr;
+
+    page->addItem(makeLiveItem(F("Min"), latency, &UiLatencySensorDevice::getMin, F("ms"), false, latency));
+    page->addItem(makeLiveItem(F("Avg"), latency, &UiLatencySensorDevice::getAverage, F("ms"), false, latency));
+    page->addItem(makeLiveItem(F("P95"), latency, &UiLatencySensorDevice::getP95, F("ms"), false, latency));
+    page->addItem(makeLiveItem(F("Max"), latency, &UiLatencySensorDevice::getMax, F("ms"), false, latency));
+    NavigationManager* nav = &NavigationManager::instance();
+    page->addItem(makeLiveItem(F("Frames"), nav, &NavigationManager::getFrameRate, F("fps"), false, latency));
+    page->addItem(makeLiveItem(F("Nav cap"), nav, &NavigationManager::getNavFrameCap, F("fps"), false, latency));
+    page->addItem(makeLiveItem(F("Live cap"), nav, &NavigationManager::getLiveFrameCap, F("fps"), false, latency));
+    for (uint8_t i = 0; i < UiLatencySensor::PAGE_SLOTS; i++) {
+        page->addItem(new PageLatencyItem(latency, i));
+    }
+
     page->addItem(new BackMenuItem());
     return page;
 }
@@ -942,38 +2596,7 @@ MenuPage* MenuBuilder::buildLightSettingsPage(void* context) {
  */
 MenuPage* MenuBuilder::buildSensorsPage(void* context) {
     static_cast<void>(context);
-    MenuPage* page = new MenuPage(F("Sensors"), NavigationManager::instance().getCurrentPage());
-    if (!page) return nullptr;
-
-    DeviceRegistry& registry = DeviceRegistry::instance();
-    const DynamicArray<IDevice*>& devices = registry.getDevices();
-    
-    for (size_t i = 0; i < devices.size(); i++) {
-        IDevice* d = devices[i];
-        if (d->isSensor()) {
-            if (d->type == DeviceType::SensorTemperature) {
-                page->addItem(new SubMenuItem(F("Temperature"), buildSensorStatsPage, d));
-                
-            } else if (d->type == DeviceType::SensorLight) {
-                page->addItem(new SubMenuItem(F("Light Sensor"), buildLightSettingsPage, d));
-                
-            } else if (d->type == DeviceType::SensorPIR) {
-                page->addItem(new LivePIRItem(static_cast<PIRSensorDevice*>(d)));
-                
-            } else if (d->type == DeviceType::SensorRAM) {
-                page->addItem(new SubMenuItem(F("Free RAM"), buildSensorStatsPage, d));
-                
-            } else if (d->type == DeviceType::SensorVCC) {
-                page->addItem(new SubMenuItem(F("VCC Voltage"), buildSensorStatsPage, d));
-                
-            } else if (d->type == DeviceType::SensorLoopTime) {
-                page->addItem(new SubMenuItem(F("Loop Time"), buildSensorStatsPage, d));
-            }
-        }
-    }
-    
-    page->addItem(new BackMenuItem());
-    return page;
+    return new DeviceListPage(F("Sensors"), sensorRow, NavigationManager::instance().getCurrentPage());
 }
 
 /**
@@ -994,17 +2617,108 @@ MenuPage* MenuBuilder::buildScenesPage(void* context) {
     return page;
 }
 
+/**
+ * @brief Builds the big-digit home screen
+ * @param context Unused
+ * @return Heap-allocated home page
+ */
+MenuPage* MenuBuilder::buildHomePage(void* context) {
+    static_cast<void>(context);
+    TemperatureSensor* sensor = nullptr;
+    const DynamicArray<IDevice*>& devices = DeviceRegistry::instance().getDevices();
+    for (size_t i = 0; i < devices.size(); i++) {
+        if (devices[i]->type == DeviceType::SensorTemperature) {
+            sensor = static_cast<TemperatureSensor*>(devices[i]);
+            break;
+        }
+    }
+    return new HomePage(sensor, NavigationManager::instance().getCurrentPage());
+}
+
+/**
+ * @brief Dashboard reader for the temperature tile
+ * @param d TemperatureSensor
+ * @return Temperature in tenths of a degree
+ */
+int16_t MenuBuilder::readTemperature(IDevice* d) {
+    return static_cast<TemperatureSensor*>(d)->getTemperature();
+}
+
+/**
+ * @brief Dashboard reader for the light level tile
+ * @param d PhotoresistorSensor
+ * @return Light level in percent
+ */
+int16_t MenuBuilder::readLightLevel(IDevice* d) {
+    return static_cast<int16_t>(static_cast<PhotoresistorSensor*>(d)->getValue());
+}
+
+/**
+ * @brief Dashboard reader for the active scenes tile
+ * @param d Unused
+ * @return Number of active scenes
+ */
+int16_t MenuBuilder::readActiveScenes(IDevice* d) {
+    static_cast<void>(d);
+    return SceneManager::instance().getActiveCount();
+}
+
+/**
+ * @brief Dashboard reader for the loop time tile
+ * @param d LoopTimeSensorDevice
+ * @return Loop time in microseconds (loops over 32.767 ms read INT16_MAX)
+ */
+int16_t MenuBuilder::readLoopTime(IDevice* d) {
+    return static_cast<LoopTimeSensorDevice*>(d)->getValue();
+}
+
+/**
+ * @brief Dashboard reader for the free RAM tile
+ * @param d RamSensorDevice
+ * @return Free RAM in bytes
+ */
+int16_t MenuBuilder::readFreeRam(IDevice* d) {
+    return static_cast<RamSensorDevice*>(d)->getValue();
+}
+
+static const char STR_TILE_TEMP[] PROGMEM = "Tmp";
+static const char STR_TILE_LIGHT[] PROGMEM = " Lgt";
+static const char STR_TILE_SCENES[] PROGMEM = "Active scenes";
+static const char STR_TILE_LOOP[] PROGMEM = "Loop time";
+static const char STR_TILE_RAM[] PROGMEM = "Free RAM";
+static const char STR_UNIT_CELSIUS[] PROGMEM = "\xDF" "C";
+static const char STR_UNIT_PERCENT[] PROGMEM = "%";
+static const char STR_UNIT_NONE[] PROGMEM = "";
+static const char STR_UNIT_US[] PROGMEM = " us";
+static const char STR_UNIT_BYTES[] PROGMEM = " B";
+
+/**
+ * @brief Dashboard layout; periods follow how fast each source can change
+ */
+const DashboardTile MenuBuilder::DASHBOARD_TILES[] PROGMEM = {
+    {STR_TILE_TEMP, STR_UNIT_CELSIUS, DeviceType::SensorTemperature, readTemperature, 5000, 0, 0, 10, true},
+    {STR_TILE_LIGHT, STR_UNIT_PERCENT, DeviceType::SensorLight, readLightLevel, 1000, 10, 0, 10, false},
+    {STR_TILE_SCENES, STR_UNIT_NONE, DeviceType::Unknown, readActiveScenes, 500, 0, 1, 20, false},
+    {STR_TILE_LOOP, STR_UNIT_US, DeviceType::SensorLoopTime, readLoopTime, 1000, 0, 2, 20, false},
+    {STR_TILE_RAM, STR_UNIT_BYTES, DeviceType::SensorRAM, readFreeRam, 2000, 0, 3, 20, false}
+};
+
+/**
+ * @brief Builds the live dashboard
+ * @param context Unused
+ * @return Heap-allocated dashboard page
+ */
+MenuPage* MenuBuilder::buildDashboardPage(void* context) {
+    static_cast<void>(context);
+    return new DashboardPage(DASHBOARD_TILES, sizeof(DASHBOARD_TILES) / sizeof(DASHBOARD_TILES[0]),
+                             NavigationManager::instance().getCurrentPage());
+}
+
 /**
  * @brief Builds main menu root page
  * @return Heap-allocated root menu page
  */
 // cppcheck-suppress unusedFunction
 MenuPage* MenuBuilder::buildMainMenu() {
-    MenuPage* root = new MenuPage(F("Main Menu"));
-    if (!root) return nullptr;
-
-    root->addItem(new SubMenuItem(F("Lights"), buildLightsPage, nullptr));
-    root->addItem(new SubMenuItem(F("Sensors"), buildSensorsPage, nullptr));
-    root->addItem(new SubMenuItem(F("Scenes"), buildScenesPage, nullptr));
-    return root;
+    return new TablePage(&MAIN_MENU, nullptr, nullptr);
 }
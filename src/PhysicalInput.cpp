@@ -6,18 +6,182 @@
  * @ingroup HAL
  */
 #include <Arduino.h>
+#include <util/atomic.h>
 #include "PhysicalInput.h"
+#include "AnalogSampler.h"
 #include "Devices.h"
 #include "FlexibleMenu.h"
 
-ButtonInput::ButtonInput(uint8_t pin, uint8_t buttonId, IDevice* linkedDevice, ButtonMode mode)
-    : _pin(pin), _buttonId(buttonId), _lastState(false), 
-      _lastDebounceTime(0), _linkedDevice(linkedDevice), _mode(mode) {
-    if (_mode == ButtonMode::ACTIVE_LOW) {
-        pinMode(_pin, INPUT_PULLUP);
-    } else {
-        pinMode(_pin, INPUT);
+ISR(PCINT0_vect) {
+    InputScanner::instance().onPinChange(0, PINB);
+}
+
+ISR(PCINT1_vect) {
+    InputScanner::instance().onPinChange(1, PINC);
+}
+
+ISR(PCINT2_vect) {
+    InputScanner::instance().onPinChange(2, PIND);
+}
+
+InputScanner::InputScanner() : _activity(false), _counting(false), _lastScan(0) {
+    for (uint8_t i = 0; i < PORTS; i++) {
+        Port& p = _ports[i];
+        p.watched = 0;
+        p.activeLow = 0;
+        p.state = 0;
+        p.count0 = 0xFF;
+        p.count1 = 0xFF;
+        p.pressed = 0;
+        p.released = 0;
+        p.latched = 0;
+        p.holdoff = 0;
+        p.holdoffScans = 0;
+    }
+}
+
+InputScanner& InputScanner::instance() {
+    static InputScanner inst;
+    return inst;
+}
+
+uint8_t InputScanner::readPort(uint8_t port) {
+    if (port == 0) return PINB;
+    if (port == 1) return PINC;
+    return PIND;
+}
+
+void InputScanner::watch(uint8_t pin, ButtonMode mode, uint8_t& port, uint8_t& mask) {
+    bool activeLow = (mode == ButtonMode::ACTIVE_LOW);
+    pinMode(pin, activeLow ? INPUT_PULLUP : INPUT);
+    port = digitalPinToPCICRbit(pin);
+    mask = digitalPinToBitMask(pin);
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        Port& p = _ports[port];
+        p.watched |= mask;
+        if (activeLow) p.activeLow |= mask;
+        // Start from the current level so a key held at boot is not a press
+        if ((readPort(port) ^ p.activeLow) & mask) p.state |= mask;
+        *digitalPinToPCMSK(pin) |= _BV(digitalPinToPCMSKbit(pin));
+        *digitalPinToPCICR(pin) |= _BV(port);
+    }
+}
+
+void InputScanner::onPinChange(uint8_t port, uint8_t levels) {
+    Port& p = _ports[port];
+    uint8_t active = (levels ^ p.activeLow) & p.watched;
+    p.latched |= active & ~p.state & ~p.holdoff;
+    _activity = true;
+}
+
+bool InputScanner::scan() {
+    for (uint8_t i = 0; i < PORTS; i++) {
+        _ports[i].pressed = 0;
+        _ports[i].released = 0;
+    }
+    if (!_activity && !_counting) return false;
+
+    uint8_t now = static_cast<uint8_t>(millis());
+    if (static_cast<uint8_t>(now - _lastScan) < SCAN_INTERVAL_MS) return false;
+    _lastScan = now;
+    _activity = false;
+
+    bool changed = false;
+    _counting = false;
+    for (uint8_t i = 0; i < PORTS; i++) {
+        Port& p = _ports[i];
+        if (!p.watched) continue;
+
+        uint8_t sample = (readPort(i) ^ p.activeLow) & p.watched;
+        sample |= p.latched & ~p.state;
+
+        // Eight 2-bit counters: reset where the sample agrees with the state,
+        // count down where it differs, and toggle the state on roll-over
+        uint8_t delta = sample ^ p.state;
+        p.count0 = ~(p.count0 & delta);
+        p.count1 = p.count0 ^ (p.count1 & delta);
+        uint8_t toggle = delta & p.count0 & p.count1;
+        p.state ^= toggle;
+
+        p.pressed = toggle & p.state;
+        p.released = toggle & ~p.state;
+        if (toggle) {
+            // A bounce may have been latched between the state update and here
+            ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+                p.latched &= ~toggle;
+                p.holdoff |= p.released;
+            }
+        }
+        if (p.released) {
+            p.holdoffScans = HOLDOFF_SCANS;
+        } else if (p.holdoffScans > 0 && --p.holdoffScans == 0) {
+            p.holdoff = 0;
+        }
+        if (p.holdoff || (delta & ~toggle)) _counting = true;
+        if (toggle) changed = true;
+    }
+    return changed;
+}
+
+ButtonGesture GestureRecognizer::press(uint16_t now) {
+    _down = true;
+    _held = false;
+    _repeats = 0;
+    _pressAt = now;
+    if (_clicks > 0 && static_cast<uint16_t>(now - _releaseAt) <= DOUBLE_CLICK_MS) {
+        _clicks = 0;
+        _held = true;  // The second press of a pair never becomes a click
+        return ButtonGesture::DOUBLE_CLICK;
+    }
+    return ButtonGesture::PRESS;
+}
+
+ButtonGesture GestureRecognizer::release(uint16_t now) {
+    _down = false;
+    _releaseAt = now;
+    if (_held) {
+        return (_repeats > 0 || (_options & LONG_PRESS)) ? ButtonGesture::RELEASE : ButtonGesture::NONE;
+    }
+    if (_options & DOUBLE_CLICK) {
+        _clicks = 1;
+        return ButtonGesture::NONE;
     }
+    return ButtonGesture::CLICK;
+}
+
+ButtonGesture GestureRecognizer::poll(uint16_t now) {
+    if (!_down) {
+        if (_clicks > 0 && static_cast<uint16_t>(now - _releaseAt) > DOUBLE_CLICK_MS) {
+            _clicks = 0;
+            return ButtonGesture::CLICK;
+        }
+        return ButtonGesture::NONE;
+    }
+    if (!(_options & (LONG_PRESS | REPEAT))) return ButtonGesture::NONE;
+
+    if (!_held) {
+        uint16_t holdMs = (_options & LONG_PRESS) ? LONG_PRESS_MS : REPEAT_DELAY_MS;
+        if (static_cast<uint16_t>(now - _pressAt) < holdMs) return ButtonGesture::NONE;
+        _held = true;
+        _clicks = 0;
+        if (_options & LONG_PRESS) {
+            _nextRepeat = now + REPEAT_DELAY_MS;
+            return ButtonGesture::LONG_PRESS;
+        }
+        _nextRepeat = now;
+    }
+
+    if (!(_options & REPEAT) || static_cast<int16_t>(now - _nextRepeat) < 0) return ButtonGesture::NONE;
+    if (_repeats < 255) _repeats++;
+    uint8_t interval = (_repeats < 11) ? REPEAT_START_MS - 10 * _repeats : REPEAT_MIN_MS;
+    _nextRepeat = now + interval;
+    return ButtonGesture::REPEAT;
+}
+
+ButtonInput::ButtonInput(uint8_t pin, uint8_t buttonId, IDevice* linkedDevice, ButtonMode mode)
+    : _buttonId(buttonId), _linkedDevice(linkedDevice), _handler(nullptr) {
+    InputScanner::instance().watch(pin, mode, _port, _mask);
     
     if (_linkedDevice) {
         EventSystem::instance().addListener(this, EventType::DeviceStateChanged);
@@ -25,25 +189,36 @@ ButtonInput::ButtonInput(uint8_t pin, uint8_t buttonId, IDevice* linkedDevice, B
 }
 
 void ButtonInput::update() {
-    bool reading;
-    if (_mode == ButtonMode::ACTIVE_LOW) {
-        reading = (digitalRead(_pin) == LOW);
+    InputScanner& scanner = InputScanner::instance();
+    bool pressed = scanner.pressed(_port) & _mask;
+    bool released = scanner.released(_port) & _mask;
+    if (!pressed && !released && !_gestures.isActive()) return;
+
+    uint16_t now = static_cast<uint16_t>(millis());
+    ButtonGesture gesture;
+    if (pressed) {
+        gesture = _gestures.press(now);
+    } else if (released) {
+        gesture = _gestures.release(now);
     } else {
-        reading = (digitalRead(_pin) == HIGH);
+        gesture = _gestures.poll(now);
     }
-    
-    if (reading != _lastState) {
-        _lastDebounceTime = millis();
-    }
-    
-    if ((millis() - _lastDebounceTime) > DEBOUNCE_DELAY) {
-        if (reading && !_lastState) {
-            onButtonPressed();
-        }
-        _lastState = reading;
+
+    if (!_handler) {
+        if (gesture == ButtonGesture::PRESS) onButtonPressed();
+    } else if (gesture == ButtonGesture::CLICK) {
+        onButtonPressed();
+    } else if (gesture == ButtonGesture::LONG_PRESS || gesture == ButtonGesture::DOUBLE_CLICK) {
+        _handler(gesture, _linkedDevice);
     }
 }
 
+// cppcheck-suppress unusedFunction
+void ButtonInput::setGestureHandler(GestureHandler handler, uint8_t options) {
+    _handler = handler;
+    _gestures.setOptions(handler ? options : 0);
+}
+
 void ButtonInput::onButtonPressed() {
     if (_linkedDevice) {
         EventSystem::instance().emit(EventType::ButtonPressed, _linkedDevice, _buttonId);
@@ -57,31 +232,28 @@ void ButtonInput::handleEvent(EventType type, IDevice* device, int value) {
 }
 
 PotentiometerInput::PotentiometerInput(uint8_t pin, DimmableLight* linkedLight)
-    : _pin(pin), _light(linkedLight), _lastMappedValue(0), _sampleIndex(0) {
-    pinMode(_pin, INPUT);
-    
-    uint16_t initial = analogRead(_pin);
-    for (uint8_t i = 0; i < SAMPLE_COUNT; i++) {
-        _samples[i] = initial;
+    : _light(linkedLight), _level(0), _sum(0) {
+    _slot = AnalogSampler::instance().add(pin);
+    if (_slot != AnalogSampler::NO_SLOT) {
+        uint16_t initial;
+        AnalogSampler::instance().take(_slot, initial);
+        _sum = static_cast<uint16_t>(initial << FILTER_SHIFT);
     }
 }
 
 void PotentiometerInput::update() {
-    if (!_light) return;
-    
-    _samples[_sampleIndex] = analogRead(_pin);
-    _sampleIndex = (_sampleIndex + 1) % SAMPLE_COUNT;
-    
-    uint32_t sum = 0;
-    for (uint8_t i = 0; i < SAMPLE_COUNT; i++) {
-        sum += _samples[i];
-    }
-    uint16_t avg = sum / SAMPLE_COUNT;
-    
-    uint8_t mappedValue = map(avg, 0, 1023, 0, 100);
-    
-    if (abs((int)mappedValue - (int)_lastMappedValue) >= POT_CHANGE_THRESHOLD) {
-        _lastMappedValue = mappedValue;
+    uint16_t sample;
+    if (!_light || !AnalogSampler::instance().take(_slot, sample)) return;
+
+    _sum = _sum - (_sum >> FILTER_SHIFT) + sample;
+    uint16_t avg = _sum >> FILTER_SHIFT;
+
+    // 0-1023 to 0-100 in 1/256 level units: 1023 * 25 still fits 16 bits
+    uint16_t scaled = avg * 25;
+    uint16_t center = static_cast<uint16_t>(_level) << 8;
+    if (scaled + 128 + HYSTERESIS <= center || scaled >= center + 128 + HYSTERESIS) {
+        uint8_t mappedValue = static_cast<uint8_t>((scaled + 128) >> 8);
+        _level = mappedValue;
         
         if (mappedValue < POT_OFF_THRESHOLD) {
             if (_light->getState()) {
@@ -97,32 +269,113 @@ void PotentiometerInput::update() {
 }
 
 NavButtonInput::NavButtonInput(uint8_t pin, InputEvent command, ButtonMode mode)
-    : _pin(pin), _command(command), _lastState(false), 
-      _lastDebounceTime(0), _mode(mode) {
-    if (_mode == ButtonMode::ACTIVE_LOW) {
-        pinMode(_pin, INPUT_PULLUP);
-    } else {
-        pinMode(_pin, INPUT);
-    }
+    : _command(command),
+      _gestures((command == InputEvent::UP || command == InputEvent::DOWN) ? GestureRecognizer::REPEAT : 0) {
+    InputScanner::instance().watch(pin, mode, _port, _mask);
 }
 
 void NavButtonInput::update() {
-    bool reading;
-    if (_mode == ButtonMode::ACTIVE_LOW) {
-        reading = (digitalRead(_pin) == LOW);
+    InputScanner& scanner = InputScanner::instance();
+    bool pressed = scanner.pressed(_port) & _mask;
+    bool released = scanner.released(_port) & _mask;
+    if (!pressed && !released && !_gestures.isActive()) return;
+
+    uint16_t now = static_cast<uint16_t>(millis());
+    ButtonGesture gesture;
+    if (pressed) {
+        gesture = _gestures.press(now);
+    } else if (released) {
+        gesture = _gestures.release(now);
     } else {
-        reading = (digitalRead(_pin) == HIGH);
+        gesture = _gestures.poll(now);
     }
-    
-    if (reading != _lastState) {
-        _lastDebounceTime = millis();
+
+    if (gesture == ButtonGesture::PRESS) {
+        InputQueue::instance().push(_command);
+    } else if (gesture == ButtonGesture::REPEAT) {
+        InputQueue::instance().push(_command, repeatStep());
+    } else if (gesture == ButtonGesture::RELEASE) {
+        InputQueue::instance().push(InputEvent::RELEASE);
     }
-    
-    if ((millis() - _lastDebounceTime) > DEBOUNCE_DELAY) {
-        if (reading && !_lastState) {
-            NavigationManager::instance().handleInput(_command);
+}
+
+uint8_t NavButtonInput::repeatStep() const {
+    uint8_t repeats = _gestures.getRepeats();
+    if (repeats < 10) return 1;
+    if (repeats < 25) return 2;
+    return 4;
+}
+
+KnobInput::KnobInput()
+    : _gestures(GestureRecognizer::DOUBLE_CLICK | GestureRecognizer::LONG_PRESS),
+      _lastValue(0), _down(false), _ramping(false), _present(false), _lastRead(0), _lastUse(0) {}
+
+bool KnobInput::begin() {
+    _present = _knob.begin();
+    return _present;
+}
+
+uint8_t KnobInput::pollInterval(uint16_t now) const {
+    if (_ramping || _gestures.isActive() || static_cast<uint16_t>(now - _lastUse) < IN_USE_MS) {
+        return POLL_FAST_MS;
+    }
+    return NavigationManager::instance().isIdle() ? POLL_IDLE_MS : POLL_AWAKE_MS;
+}
+
+void KnobInput::onTurn(int16_t delta, uint16_t now) {
+    uint16_t gap = now - _lastUse;
+    _lastUse = now;
+
+    InputEvent event = (delta > 0) ? InputEvent::DOWN : InputEvent::UP;
+    uint16_t detents = (delta > 0) ? delta : -static_cast<int32_t>(delta);
+    if (detents > MAX_DETENTS) detents = MAX_DETENTS;
+
+    uint16_t perDetent = gap / detents;
+    uint8_t step = 0;
+    if (perDetent < FAST_DETENT_MS) step = 4;
+    else if (perDetent < SLOW_DETENT_MS) step = 2;
+    if (step) _ramping = true;
+
+    for (uint8_t i = 0; i < detents; i++) {
+        InputQueue::instance().push(event, step);
+    }
+}
+
+void KnobInput::update() {
+    if (!_present) return;
+
+    uint16_t now = static_cast<uint16_t>(millis());
+    ButtonGesture gesture = ButtonGesture::NONE;
+
+    if (static_cast<uint16_t>(now - _lastRead) >= pollInterval(now)) {
+        _lastRead = now;
+        int16_t value;
+        bool down;
+        if (_knob.read(value, down)) {
+            int16_t delta = static_cast<int16_t>(value - _lastValue);
+            _lastValue = value;
+            if (delta != 0) {
+                onTurn(delta, now);
+            } else if (_ramping && static_cast<uint16_t>(now - _lastUse) >= SETTLE_MS) {
+                _ramping = false;
+                InputQueue::instance().push(InputEvent::RELEASE);
+            }
+
+            if (down != _down) {
+                _down = down;
+                _lastUse = now;
+                gesture = down ? _gestures.press(now) : _gestures.release(now);
+            }
         }
-        _lastState = reading;
+    }
+    if (gesture == ButtonGesture::NONE && _gestures.isActive()) {
+        gesture = _gestures.poll(now);
+    }
+
+    if (gesture == ButtonGesture::CLICK) {
+        InputQueue::instance().push(InputEvent::ENTER);
+    } else if (gesture == ButtonGesture::DOUBLE_CLICK || gesture == ButtonGesture::LONG_PRESS) {
+        InputQueue::instance().push(InputEvent::BACK);
     }
 }
 
@@ -146,8 +399,15 @@ void InputManager::registerNavButton(NavButtonInput* navBtn) {
     _navButtons.add(navBtn);
 }
 
+// cppcheck-suppress unusedFunction
+void InputManager::registerKnob(KnobInput* knob) {
+    _knob = knob;
+}
+
 // cppcheck-suppress unusedFunction
 void InputManager::updateAll() {
+    InputScanner::instance().scan();
+    AnalogSampler::instance().update();
     for (uint8_t i = 0; i < _buttons.size(); i++) {
         _buttons[i]->update();
     }
@@ -157,4 +417,5 @@ void InputManager::updateAll() {
     for (uint8_t i = 0; i < _navButtons.size(); i++) {
         _navButtons[i]->update();
     }
+    if (_knob) _knob->update();
 }
\ No newline at end of file
@@ -211,6 +211,7 @@ void AlarmScene::onDeactivate() {
 void AlarmScene::handleEvent(EventType type, IDevice* device, int value) {
     if (type == EventType::SensorUpdated && device->type == DeviceType::SensorPIR) {
         if (value == 1) {
+            if (!_triggered) EventSystem::instance().emit(EventType::AlarmTriggered, device, value);
             _triggered = true;
             _lastMotion = millis();
         }
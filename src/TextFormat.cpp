@@ -0,0 +1,103 @@
+/**
+ * @file TextFormat.cpp
+ * @brief Implementation of fixed-width text formatting
+ * @author Andrea Bortolotti
+ * @version 2.0
+ * @ingroup UI
+ */
+#include "TextFormat.h"
+#include <avr/pgmspace.h>
+
+/**
+ * @brief Powers of ten used for digit extraction by subtraction
+ */
+static const uint16_t POW10[] PROGMEM = { 10000, 1000, 100, 10 };
+
+// cppcheck-suppress unusedFunction
+void TextFormat::fill(char* dst, uint8_t width, char c) {
+    memset(dst, c, width);
+}
+
+uint8_t TextFormat::putLabel(char* dst, uint8_t width, const __FlashStringHelper* text) {
+    const char* p = reinterpret_cast<const char*>(text);
+    uint8_t n = 0;
+    if (p) {
+        char c;
+        while (n < width && (c = static_cast<char>(pgm_read_byte(p + n))) != '\0') {
+            dst[n++] = c;
+        }
+    }
+    memset(dst + n, ' ', width - n);
+    return n;
+}
+
+uint8_t TextFormat::putLabel(char* dst, uint8_t width, const char* text) {
+    uint8_t n = 0;
+    if (text) {
+        while (n < width && text[n] != '\0') {
+            dst[n] = text[n];
+            n++;
+        }
+    }
+    memset(dst + n, ' ', width - n);
+    return n;
+}
+
+void TextFormat::putUInt(char* dst, uint8_t width, uint16_t value) {
+    putNumber(dst, width, value, false, 0);
+}
+
+void TextFormat::putInt(char* dst, uint8_t width, int16_t value) {
+    bool negative = value < 0;
+    // Negate in unsigned arithmetic: -INT16_MIN does not fit an int16_t
+    uint16_t magnitude = static_cast<uint16_t>(value);
+    putNumber(dst, width, negative ? static_cast<uint16_t>(0u - magnitude) : magnitude, negative, 0);
+}
+
+void TextFormat::putDeci(char* dst, uint8_t width, int16_t deci) {
+    bool negative = deci < 0;
+    uint16_t magnitude = static_cast<uint16_t>(deci);
+    putNumber(dst, width, negative ? static_cast<uint16_t>(0u - magnitude) : magnitude, negative, 1);
+}
+
+void TextFormat::putNumber(char* dst, uint8_t width, uint16_t magnitude, bool negative, uint8_t decimals) {
+    char digits[5];
+    uint8_t first = 4;  // index of the most significant non-zero digit
+
+    for (uint8_t i = 0; i < 4; i++) {
+        uint16_t p = pgm_read_word(&POW10[i]);
+        char d = '0';
+        while (magnitude >= p) {
+            magnitude -= p;
+            d++;
+        }
+        digits[i] = d;
+        if (d != '0' && first == 4) first = i;
+    }
+    digits[4] = static_cast<char>('0' + magnitude);
+
+    // Keep one leading zero in front of the decimal point ("0.5")
+    if (decimals && first > 3) first = 3;
+
+    uint8_t count = 5 - first;
+    uint8_t needed = count + decimals + (negative ? 1 : 0);
+    if (needed > width) {
+        memset(dst, '#', width);
+        return;
+    }
+
+    char* out = dst + width;
+    const char* src = digits + 5;
+    if (decimals) {
+        *--out = *--src;
+        *--out = '.';
+        count--;
+    }
+    while (count--) {
+        *--out = *--src;
+    }
+    if (negative) *--out = '-';
+    while (out > dst) {
+        *--out = ' ';
+    }
+}
@@ -1,9 +1,79 @@
 /**
  * @file VirtualSensors.cpp
- * @brief Static member definitions for virtual sensors
+ * @brief Static member definitions and out-of-line code for virtual sensors
  * @ingroup Devices
  */
 #include "sensors.h"
 
 // Static instance pointer initialization (moved from header to avoid multiple definition)
 LoopTimeSensor* LoopTimeSensor::_instance = nullptr;
+UiLatencySensor* UiLatencySensor::_instance = nullptr;
+
+/**
+ * @brief Histogram bucket upper edges, roughly 1.5x apart
+ * @details Fine steps below 50 ms where a cursor move lands, coarse ones
+ * for full-page rebuilds; the last bucket catches everything above.
+ */
+const uint16_t UiLatencySensor::BUCKET_LIMITS[BUCKETS] PROGMEM = {
+    5, 10, 15, 20, 30, 40, 50, 65, 80, 100, 130, 170, 220, 300, 400, 0xFFFF
+};
+
+UiLatencySensor::UiLatencySensor()
+    : Sensor<int16_t>(), _last(0), _min(0xFFFF), _max(0), _sum(0), _count(0) {
+    for (uint8_t i = 0; i < BUCKETS; i++) _histogram[i] = 0;
+    for (uint8_t i = 0; i < PAGE_SLOTS; i++) _pages[i] = {nullptr, 0, 0, 0};
+    _instance = this;
+}
+
+void UiLatencySensor::decay() {
+    for (uint8_t i = 0; i < BUCKETS; i++) _histogram[i] >>= 1;
+    _sum >>= 1;
+    _count >>= 1;
+    for (uint8_t i = 0; i < PAGE_SLOTS; i++) {
+        _pages[i].sum >>= 1;
+        _pages[i].count >>= 1;
+    }
+}
+
+void UiLatencySensor::registerLatency(uint16_t ms, const __FlashStringHelper* page) {
+    UiLatencySensor* s = _instance;
+    if (!s) return;
+
+    if (s->_count == 0xFFFF) s->decay();
+    s->_last = ms;
+    if (ms < s->_min) s->_min = ms;
+    if (ms > s->_max) s->_max = ms;
+    s->_sum += ms;
+    s->_count++;
+
+    uint8_t bucket = 0;
+    while (ms > pgm_read_word(&BUCKET_LIMITS[bucket])) bucket++;
+    s->_histogram[bucket]++;
+
+    // Find the page, else take a free slot or replace the least used one
+    uint8_t slot = 0;
+    for (uint8_t i = 0; i < PAGE_SLOTS; i++) {
+        if (s->_pages[i].title == page) { slot = i; break; }
+        if (s->_pages[i].count < s->_pages[slot].count) slot = i;
+    }
+    PageLatency& entry = s->_pages[slot];
+    if (entry.title != page) entry = {page, 0, 0, 0};
+    if (entry.count == 0xFFFF) s->decay();
+    entry.count++;
+    entry.sum += ms;
+    if (ms > entry.max) entry.max = ms;
+}
+
+uint16_t UiLatencySensor::getP95() const {
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < BUCKETS; i++) total += _histogram[i];
+    if (total == 0) return 0;
+
+    uint32_t target = (total * 95 + 99) / 100;
+    uint32_t seen = 0;
+    for (uint8_t i = 0; i < BUCKETS - 1; i++) {
+        seen += _histogram[i];
+        if (seen >= target) return pgm_read_word(&BUCKET_LIMITS[i]);
+    }
+    return _max;
+}
@@ -15,7 +15,6 @@
     #include <Arduino.h>
     extern "C" {
     #include "i2cmaster.h"
-    #include "lcd.h"
     }
     #include "FlexibleMenu.h"
     #include "MemoryMonitor.h"
@@ -28,6 +27,74 @@ NightModeScene nightMode;
 PartyScene partyMode;
 AlarmScene alarmMode;
 
+/**
+ * @brief Long press on a light button: open the light's brightness page
+ * @param gesture Gesture reported by the button
+ * @param device Light linked to the button
+ */
+static void openBrightnessGesture(ButtonGesture gesture, IDevice* device) {
+    if (gesture == ButtonGesture::LONG_PRESS && device) {
+        NavigationManager::instance().requestPage(MenuBuilder::buildBrightnessPage, device);
+    }
+}
+
+/**
+ * @brief Long press on the RGB button: step through Off, Night and Party scenes
+ * @param gesture Gesture reported by the button
+ * @param device Unused
+ */
+static void cycleScenesGesture(ButtonGesture gesture, IDevice* device) {
+    static_cast<void>(device);
+    if (gesture != ButtonGesture::LONG_PRESS) return;
+
+    SceneManager& scenes = SceneManager::instance();
+    if (nightMode.isActive()) {
+        scenes.removeScene(&nightMode);
+        scenes.addScene(&partyMode);
+        NavigationManager::instance().notify(F("Scene"), F("Party Mode"));
+    } else if (partyMode.isActive()) {
+        scenes.removeScene(&partyMode);
+        NavigationManager::instance().notify(F("Scene"), F("Off"));
+    } else {
+        scenes.addScene(&nightMode);
+        NavigationManager::instance().notify(F("Scene"), F("Night Mode"));
+    }
+}
+
+#if DEBUG_LCD_BENCH
+/**
+ * @brief Times full-page redraws and shows the average on the display
+ * @details Every pass rewrites all 80 cells with a different character, so
+ * buffered backends cannot skip any of them. Build with and without
+ * -D LCD_PARALLEL to compare the parallel and PCF8574 paths.
+ */
+static void runDisplayBenchmark() {
+    IDisplay& display = IDisplay::instance();
+    const uint8_t runs = 8;
+    char line[IDisplay::COLS];
+
+    unsigned long start = micros();
+    for (uint8_t i = 0; i < runs; i++) {
+        TextFormat::fill(line, IDisplay::COLS, (i & 1) ? 'X' : 'O');
+        for (uint8_t row = 0; row < IDisplay::ROWS; row++) {
+            display.setCursor(0, row);
+            display.write(line, IDisplay::COLS);
+        }
+        display.flush();
+    }
+    unsigned long perPage = (micros() - start) / runs;
+
+    TextFormat::putLabel(line, 11, F("Page redraw"));
+    TextFormat::putDeci(line + 11, 6, static_cast<int16_t>(perPage / 100));
+    TextFormat::putLabel(line + 17, 3, F(" ms"));
+    display.clear();
+    display.setCursor(0, 0);
+    display.write(line, IDisplay::COLS);
+    display.flush();
+    delay(3000);
+}
+#endif
+
 /**
 
     @brief System initialization
@@ -36,7 +103,7 @@ AlarmScene alarmMode;
 
         Creates devices via Factory
 
-        Registers physical inputs (Buttons/Pots)
+        Registers physical inputs (Buttons/Pots/Knob)
 
         Builds the dynamic menu structure
         */
@@ -49,11 +116,16 @@ digitalWrite(LED_BUILTIN, LOW);
 #endif
     
 i2c_init();
-LCD_init();
-LCD_backlight();
-LCD_clear();
-LCD_set_cursor(0, 0);
-LCD_write_str("Booting...");
+IDisplay& display = IDisplay::instance();
+display.begin();
+display.clear();
+display.setCursor(0, 0);
+display.print("Booting...");
+display.flush();
+
+#if DEBUG_LCD_BENCH
+runDisplayBenchmark();
+#endif
 
 NavigationManager::instance().setLCD();
 
@@ -80,16 +152,20 @@ if (outsidePhoto && outsidePIR) {
 DeviceFactory::createRamSensor(F("Free RAM"));
 DeviceFactory::createVoltageSensor(F("VCC"));
 DeviceFactory::createLoopTimeSensor(F("Loop Time"));
+DeviceFactory::createLcdTrafficSensor(F("LCD Traffic"));
+DeviceFactory::createUiLatencySensor(F("UI Latency"));
 
 // ===== Setup Light Control Buttons =====
 DeviceRegistry& registry = DeviceRegistry::instance();
 
 // Living Room / Bedroom
 ButtonInput* btnLiving = new ButtonInput(8, 1, registry.getDevices()[1], ButtonMode::ACTIVE_LOW);
+btnLiving->setGestureHandler(openBrightnessGesture);
 InputManager::instance().registerButton(btnLiving);
 
 // Kitchen
 ButtonInput* btnKitchen = new ButtonInput(13, 2, registry.getDevices()[0], ButtonMode::ACTIVE_LOW);
+btnKitchen->setGestureHandler(openBrightnessGesture);
 InputManager::instance().registerButton(btnKitchen);
 
 // Bedroom (Mapped to secondary Kitchen button pin from reference)
@@ -98,6 +174,7 @@ InputManager::instance().registerButton(btnBedroom);
 
 // Reserved / RGB
 ButtonInput* btnReserved = new ButtonInput(16, 4, registry.getDevices()[2], ButtonMode::ACTIVE_LOW);
+btnReserved->setGestureHandler(cycleScenesGesture);
 InputManager::instance().registerButton(btnReserved);
 
 // Living Room Potentiometer
@@ -111,20 +188,28 @@ PotentiometerInput* pot1 = new PotentiometerInput(A1, rgbLight);
 InputManager::instance().registerPotentiometer(pot1);
 
 
-// ===== Setup Menu Navigation Buttons =====
-// UP 12 -> BACK 2
-// DOWN 17 -> UP 12
-// ENTER 4 -> ENTER
-// BACK 2 -> DOWN 17
-NavButtonInput* navUp = new NavButtonInput(17, InputEvent::UP, ButtonMode::ACTIVE_LOW);
-NavButtonInput* navDown = new NavButtonInput(2, InputEvent::DOWN, ButtonMode::ACTIVE_LOW);
-NavButtonInput* navSelect = new NavButtonInput(4, InputEvent::ENTER, ButtonMode::ACTIVE_LOW);
-NavButtonInput* navBack = new NavButtonInput(12, InputEvent::BACK, ButtonMode::ACTIVE_LOW);
-
-InputManager::instance().registerNavButton(navUp);
-InputManager::instance().registerNavButton(navDown);
-InputManager::instance().registerNavButton(navSelect);
-InputManager::instance().registerNavButton(navBack);
+// ===== Setup Menu Navigation =====
+// A Modulino Knob replaces the four buttons; without one, fall back to them
+KnobInput* knob = new KnobInput();
+if (knob->begin()) {
+    InputManager::instance().registerKnob(knob);
+} else {
+    delete knob;
+
+    // UP 12 -> BACK 2
+    // DOWN 17 -> UP 12
+    // ENTER 4 -> ENTER
+    // BACK 2 -> DOWN 17
+    NavButtonInput* navUp = new NavButtonInput(17, InputEvent::UP, ButtonMode::ACTIVE_LOW);
+    NavButtonInput* navDown = new NavButtonInput(2, InputEvent::DOWN, ButtonMode::ACTIVE_LOW);
+    NavButtonInput* navSelect = new NavButtonInput(4, InputEvent::ENTER, ButtonMode::ACTIVE_LOW);
+    NavButtonInput* navBack = new NavButtonInput(12, InputEvent::BACK, ButtonMode::ACTIVE_LOW);
+
+    InputManager::instance().registerNavButton(navUp);
+    InputManager::instance().registerNavButton(navDown);
+    InputManager::instance().registerNavButton(navSelect);
+    InputManager::instance().registerNavButton(navBack);
+}
 
 // ===== Build Menu =====
 MenuPage* mainMenu = MenuBuilder::buildMainMenu();
@@ -132,17 +217,22 @@ MenuPage* mainMenu = MenuBuilder::buildMainMenu();
 if (mainMenu) {
     NavigationManager::instance().initialize(mainMenu);
 
-    LCD_clear();
-    LCD_set_cursor(0, 0);
-    LCD_write_str("System Ready!");
+    display.clear();
+    display.setCursor(0, 0);
+    display.print("System Ready!");
+    display.flush();
     delay(1000);
+
+    // Boot into the home screen; BACK reveals the main menu
+    NavigationManager::instance().pushPage(MenuBuilder::buildHomePage(nullptr));
 } else {
     // Critical Error Handler for memory exhaustion
-    LCD_clear();
-    LCD_set_cursor(0, 0);
-    LCD_write_str("CRITICAL ERROR:");
-    LCD_set_cursor(0, 1);
-    LCD_write_str("Menu Alloc Failed");
+    display.clear();
+    display.setCursor(0, 0);
+    display.print("CRITICAL ERROR:");
+    display.setCursor(0, 1);
+    display.print("Menu Alloc Failed");
+    display.flush();
     while(1); // Halt system
 }
 
@@ -182,7 +272,8 @@ void loop() {
     NavigationManager::instance().update();
 
     // 5. Register loop execution time for monitoring
-    unsigned long loopEnd = micros();
-    uint16_t loopDuration = (uint16_t)(loopEnd - loopStart);
+    // Saturate rather than wrap: a loop over 65.5 ms must not read as a short one
+    unsigned long loopElapsed = micros() - loopStart;
+    uint16_t loopDuration = loopElapsed > 0xFFFFUL ? 0xFFFF : (uint16_t)loopElapsed;
     LoopTimeSensorDevice::registerLoopTime(loopDuration);
 }
\ No newline at end of file